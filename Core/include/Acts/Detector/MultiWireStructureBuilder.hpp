@@ -46,6 +46,10 @@ class MultiWireStructureBuilder {
 
     /// A tolerance config
     float toleranceOverlap = 10.;
+
+    /// Navigate the wires with the analytic crossing of the regular wire
+    /// grid in the layer frame, i.e. only the crossed wires are intersected
+    bool analyticNavigation = true;
   };
 
   /// Constructor
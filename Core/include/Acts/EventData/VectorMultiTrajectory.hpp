@@ -20,6 +20,7 @@
 #include "Acts/Utilities/ThrowAssert.hpp"
 
 #include <any>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <iosfwd>
@@ -47,6 +48,16 @@ constexpr auto MeasurementSizeMax = MultiTrajectoryTraits::MeasurementSizeMax;
 
 class VectorMultiTrajectoryBase {
  public:
+  /// Storage of the predicted, filtered and smoothed covariances
+  enum class CovarianceStorage {
+    /// Full matrices in double precision
+    Full,
+    /// Upper triangle of the symmetric matrices in double precision
+    Packed,
+    /// Upper triangle of the symmetric matrices in single precision
+    PackedFloat,
+  };
+
   struct Statistics {
     using axis_t = boost::histogram::axis::variant<
         boost::histogram::axis::category<std::string>,
@@ -100,6 +111,12 @@ class VectorMultiTrajectoryBase {
       using scalar = typename decltype(ts.predicted())::Scalar;
       std::size_t par_size = eBoundSize * sizeof(scalar);
       std::size_t cov_size = eBoundSize * eBoundSize * sizeof(scalar);
+      std::size_t jac_size = cov_size;
+      if (m_covStorage == CovarianceStorage::Packed) {
+        cov_size = kPackedCovarianceSize * sizeof(double);
+      } else if (m_covStorage == CovarianceStorage::PackedFloat) {
+        cov_size = kPackedCovarianceSize * sizeof(float);
+      }
 
       const IndexData& index = m_index[i];
       if (ts.hasPredicted() &&
@@ -136,7 +153,7 @@ class VectorMultiTrajectoryBase {
 
       if (ts.hasJacobian() &&
           ACTS_CHECK_BIT(index.allocMask, TrackStatePropMask::Jacobian)) {
-        h("jac", isMeas, weight(cov_size));
+        h("jac", isMeas, weight(jac_size));
       }
     }
 
@@ -177,7 +194,10 @@ class VectorMultiTrajectoryBase {
         m_jac{other.m_jac},
         m_sourceLinks{other.m_sourceLinks},
         m_projectors{other.m_projectors},
-        m_referenceSurfaces{other.m_referenceSurfaces} {
+        m_referenceSurfaces{other.m_referenceSurfaces},
+        m_covStorage{other.m_covStorage},
+        m_packedCov{other.m_packedCov},
+        m_packedCovFloat{other.m_packedCovFloat} {
     for (const auto& [key, value] : other.m_dynamic) {
       m_dynamic.insert({key, value->clone()});
     }
@@ -185,6 +205,28 @@ class VectorMultiTrajectoryBase {
 
   VectorMultiTrajectoryBase(VectorMultiTrajectoryBase&& other) = default;
 
+  /// Append a copy of the track state sequence ending at @p itip in @p other
+  /// to this container, see VectorMultiTrajectory::appendTrackStates.
+  std::pair<IndexType, IndexType> appendTrackStatesFrom(
+      const VectorMultiTrajectoryBase& other, IndexType itip);
+
+  /// Number of values of the upper triangle of a covariance
+  static constexpr std::size_t kPackedCovarianceSize =
+      eBoundSize * (eBoundSize + 1) / 2;
+
+  /// Store the covariances packed and release the full matrices.
+  ///
+  /// @param storage The packed storage to use
+  void packCovariances(CovarianceStorage storage);
+
+  /// Expand a packed covariance into @p cov
+  ///
+  /// @param parIdx The index of the parameters
+  /// @param cov The full covariance matrix to fill
+  void unpackCovariance(
+      IndexType parIdx,
+      typename detail_lt::Types<eBoundSize>::Covariance& cov) const;
+
   // BEGIN INTERFACE HELPER
   template <typename T>
   static constexpr bool has_impl(T& instance, HashedString key,
@@ -329,6 +371,12 @@ class VectorMultiTrajectoryBase {
 
   std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
       m_dynamic;
+
+  // the covariances are only packed in the read-only container, in which case
+  // m_cov is empty
+  CovarianceStorage m_covStorage = CovarianceStorage::Full;
+  std::vector<double> m_packedCov;
+  std::vector<float> m_packedCovFloat;
 };
 
 }  // namespace detail_vmt
@@ -418,6 +466,25 @@ class VectorMultiTrajectory final
 
   void reserve(std::size_t n);
 
+  /// Append a copy of the track state sequence ending at @p itip in @p other
+  /// to this container.
+  ///
+  /// The track states are copied column by column with their indices rebased
+  /// to this container, which avoids going through track state proxies for
+  /// each component. Components shared within a track state stay shared.
+  /// Dynamic columns are copied if they exist in both containers, otherwise
+  /// they are default initialized. The appended sequence is linked both
+  /// backward and forward, with the innermost track state stored first.
+  ///
+  /// @param other The container holding the track states to copy
+  /// @param itip The index of the last track state of the sequence in @p other
+  /// @return The indices of the innermost (stem) and last (tip) appended
+  ///         track state, both invalid if @p itip is invalid
+  std::pair<IndexType, IndexType> appendTrackStates(
+      const detail_vmt::VectorMultiTrajectoryBase& other, IndexType itip) {
+    return appendTrackStatesFrom(other, itip);
+  }
+
   void shareFrom_impl(IndexType iself, IndexType iother,
                       TrackStatePropMask shareSource,
                       TrackStatePropMask shareTarget);
@@ -503,17 +570,36 @@ class ConstVectorMultiTrajectory final
  public:
   ConstVectorMultiTrajectory() = default;
 
-  ConstVectorMultiTrajectory(const ConstVectorMultiTrajectory& other)
-      : VectorMultiTrajectoryBase{other} {}
+  ConstVectorMultiTrajectory(const ConstVectorMultiTrajectory& other);
 
   ConstVectorMultiTrajectory(const VectorMultiTrajectory& other)
       : VectorMultiTrajectoryBase{other} {}
 
-  ConstVectorMultiTrajectory(VectorMultiTrajectory&& other)
-      : VectorMultiTrajectoryBase{std::move(other)} {}
+  /// Take over the track states of a mutable container.
+  ///
+  /// With packed @p storage only the upper triangle of the predicted,
+  /// filtered and smoothed covariances is kept, which reduces their memory
+  /// by almost a factor two, or four in single precision. The content is
+  /// unchanged, apart from the reduced precision of
+  /// CovarianceStorage::PackedFloat. A covariance is expanded on its first
+  /// access and kept for the lifetime of the container, so that the returned
+  /// maps stay valid. The jacobians are always stored in full.
+  ///
+  /// @param other The container to take the track states from
+  /// @param storage The storage of the covariances
+  ConstVectorMultiTrajectory(
+      VectorMultiTrajectory&& other,
+      CovarianceStorage storage = CovarianceStorage::Full);
 
   ConstVectorMultiTrajectory(ConstVectorMultiTrajectory&&) = default;
 
+  ~ConstVectorMultiTrajectory();
+
+  /// The storage of the predicted, filtered and smoothed covariances
+  CovarianceStorage covarianceStorage() const {
+    return m_covStorage;
+  }
+
   Statistics statistics() const {
     return detail_vmt::VectorMultiTrajectoryBase::statistics(*this);
   }
@@ -525,7 +611,10 @@ class ConstVectorMultiTrajectory final
   }
 
   ConstTrackStateProxy::Covariance covariance_impl(IndexType parIdx) const {
-    return ConstTrackStateProxy::Covariance{m_cov[parIdx].data()};
+    if (m_covStorage == CovarianceStorage::Full) {
+      return ConstTrackStateProxy::Covariance{m_cov[parIdx].data()};
+    }
+    return ConstTrackStateProxy::Covariance{expandedCovariance(parIdx).data()};
   }
 
   ConstTrackStateProxy::Covariance jacobian_impl(IndexType istate) const {
@@ -566,6 +655,18 @@ class ConstVectorMultiTrajectory final
   }
 
   // END INTERFACE
+
+ private:
+  using Covariance = typename detail_lt::Types<eBoundSize>::Covariance;
+
+  /// Allocate the slots of the expanded covariances for packed storage
+  void allocateExpandedCovariances();
+
+  /// Expand the packed covariance on first access, thread-safe
+  const Covariance& expandedCovariance(IndexType parIdx) const;
+
+  // expanded packed covariances, one slot per parameters index
+  mutable std::unique_ptr<std::atomic<Covariance*>[]> m_expandedCov;
 };
 
 ACTS_STATIC_CHECK_CONCEPT(ConstMultiTrajectoryBackend,
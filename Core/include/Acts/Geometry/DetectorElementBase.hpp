@@ -39,6 +39,17 @@ class DetectorElementBase {
   /// @param gctx The current geometry context object, e.g. alignment
   virtual const Transform3& transform(const GeometryContext& gctx) const = 0;
 
+  /// Return the inverse transform, from global into the local frame
+  ///
+  /// The default computes the rigid-body inverse on each call, i.e. it
+  /// transposes the rotation instead of inverting the full matrix. Elements
+  /// cache it next to their transform, per alignment context if needed.
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  virtual Transform3 inverseTransform(const GeometryContext& gctx) const {
+    return transform(gctx).inverse(Eigen::Isometry);
+  }
+
   /// Return surface representation - const return pattern
   virtual const Surface& surface() const = 0;
 
@@ -123,10 +123,11 @@ fieldMapRZ(const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
 /// @param[in] firstOctant Flag if set to true indicating that only the first
 /// octant of the grid points and the BField values has been given.
 /// @note If @p firstOctant is true, the function will assume a symmetrical
-///       field for all quadrants.  e.g. we have the grid values z={0,1} with
-///       BFieldValues={2,3} on the r axis.  If the flag is set to true the
-///       z-axis grid values will be set to {-1,0,1} and the BFieldValues will
-///       be set to {3,2,3}.
+///       field for all octants.  e.g. we have the grid values z={0,1} with
+///       BFieldValues={2,3} on the z axis.  If the flag is set to true the
+///       field map covers z={-1,0,1} with the BFieldValues {3,2,3}. Only the
+///       first octant is stored, lookups in the other octants are mirrored
+///       onto it.
 /// @return A field map instance for use in interpolation.
 Acts::InterpolatedBFieldMap<
     Acts::Grid<Acts::Vector3, Acts::detail::EquidistantAxis,
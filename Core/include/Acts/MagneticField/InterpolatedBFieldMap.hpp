@@ -16,8 +16,10 @@
 #include "Acts/Utilities/Interpolation.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <array>
 #include <functional>
 #include <optional>
+#include <stdexcept>
 #include <vector>
 
 namespace Acts {
@@ -70,6 +72,10 @@ class InterpolatedMagneticField : public MagneticFieldProvider {
 /// - looking up the magnetic field values on the closest grid points,
 /// - doing a linear interpolation of these magnetic field values.
 ///
+/// Field maps with mirror symmetries can store only the non-negative half of
+/// the mirrored grid axes. Lookup positions are then reflected onto the stored
+/// part of the grid and the field components are flipped accordingly.
+///
 /// @tparam grid_t The Grid type which provides the field storage and
 /// interpolation
 template <typename grid_t>
@@ -151,6 +157,8 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     Cache(const MagneticFieldContext& mctx) { (void)mctx; }
 
     std::optional<FieldCell> fieldCell;
+    /// the reflected grid axes for the cached field cell
+    unsigned int mirrorMask = 0;
     bool initialized = false;
   };
 
@@ -173,6 +181,14 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     /// @note Negative values for @p scale are accepted and will invert the
     ///       direction of the magnetic field.
     double scale = 1.;
+
+    /// @brief mirror symmetries of the field map
+    ///
+    /// Only the non-negative half of a grid axis with a set entry is stored.
+    /// Lookups at negative coordinates along this axis are reflected onto the
+    /// stored half and the global field components are multiplied with the
+    /// given signs, e.g. (-1, 1, 1) for a field with an odd x-component.
+    std::array<std::optional<Vector3>, DIM_POS> mirror{};
   };
 
   /// @brief default constructor
@@ -182,6 +198,24 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     minBin.fill(1);
     m_lowerLeft = m_cfg.grid.lowerLeftBinEdge(minBin);
     m_upperRight = m_cfg.grid.lowerLeftBinEdge(m_cfg.grid.numLocalBins());
+
+    // the sign flips for all combinations of reflected axes
+    m_flips.fill(Vector3::Ones());
+    for (unsigned int i = 0; i < DIM_POS; ++i) {
+      if (!m_cfg.mirror[i]) {
+        continue;
+      }
+      if (m_lowerLeft[i] < 0) {
+        throw std::invalid_argument(
+            "Mirrored field map axes must not extend to negative values");
+      }
+      m_mirrored = true;
+      for (unsigned int mask = 0; mask < m_flips.size(); ++mask) {
+        if ((mask & (1u << i)) != 0) {
+          m_flips[mask] = m_flips[mask].cwiseProduct(*m_cfg.mirror[i]);
+        }
+      }
+    }
   }
 
   /// @brief retrieve field cell for given position
@@ -191,8 +225,15 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   ///
   /// @pre The given @c position must lie within the range of the underlying
   ///      magnetic field map.
+  /// @note For mirrored field maps, the cell is defined on the stored part of
+  ///       the grid, i.e. it is evaluated at the reflected grid position.
   Result<FieldCell> getFieldCell(const Vector3& position) const {
-    const auto& gridPosition = m_cfg.transformPos(position);
+    auto gridPosition = m_cfg.transformPos(position);
+    if (!isInsideLocal(gridPosition)) {
+      return MagneticFieldError::OutOfBounds;
+    }
+    const unsigned int mask = reflect(gridPosition);
+
     const auto& indices = m_cfg.grid.localBinsFromPosition(gridPosition);
     const auto& lowerLeft = m_cfg.grid.lowerLeftBinEdge(indices);
     const auto& upperRight = m_cfg.grid.upperRightBinEdge(indices);
@@ -202,13 +243,10 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     std::array<Vector3, nCorners> neighbors;
     const auto& cornerIndices = m_cfg.grid.closestPointsIndices(gridPosition);
 
-    if (!isInsideLocal(gridPosition)) {
-      return MagneticFieldError::OutOfBounds;
-    }
-
     std::size_t i = 0;
     for (std::size_t index : cornerIndices) {
-      neighbors.at(i++) = m_cfg.transformBField(m_cfg.grid.at(index), position);
+      neighbors.at(i++) = flip(
+          m_cfg.transformBField(m_cfg.grid.at(index), position), mask);
     }
 
     assert(i == nCorners);
@@ -219,16 +257,29 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   /// @brief get the number of bins for all axes of the field map
   ///
   /// @return vector returning number of bins for all field map axes
+  /// @note Mirrored axes are counted as if both halves were stored.
   std::vector<std::size_t> getNBins() const final {
     auto nBinsArray = m_cfg.grid.numLocalBins();
-    return std::vector<std::size_t>(nBinsArray.begin(), nBinsArray.end());
+    std::vector<std::size_t> nBins(nBinsArray.begin(), nBinsArray.end());
+    for (unsigned int i = 0; i < DIM_POS; ++i) {
+      if (m_cfg.mirror[i]) {
+        nBins[i] = 2 * nBins[i] - 1;
+      }
+    }
+    return nBins;
   }
 
   /// @brief get the minimum value of all axes of the field map
   ///
   /// @return vector returning the minima of all field map axes
   std::vector<double> getMin() const final {
-    return std::vector<double>(m_lowerLeft.begin(), m_lowerLeft.end());
+    std::vector<double> min(m_lowerLeft.begin(), m_lowerLeft.end());
+    for (unsigned int i = 0; i < DIM_POS; ++i) {
+      if (m_cfg.mirror[i]) {
+        min[i] = -m_upperRight[i];
+      }
+    }
+    return min;
   }
 
   /// @brief get the maximum value of all axes of the field map
@@ -254,8 +305,14 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   ///         otherwise @c false
   bool isInsideLocal(const ActsVector<DIM_POS>& gridPosition) const {
     for (unsigned int i = 0; i < DIM_POS; ++i) {
-      if (gridPosition[i] < m_lowerLeft[i] ||
-          gridPosition[i] >= m_upperRight[i]) {
+      // the reflected upper edge is the lower edge of the unfolded grid
+      if (m_cfg.mirror[i] && gridPosition[i] < 0) {
+        if (-gridPosition[i] < m_lowerLeft[i] ||
+            -gridPosition[i] > m_upperRight[i]) {
+          return false;
+        }
+      } else if (gridPosition[i] < m_lowerLeft[i] ||
+                 gridPosition[i] >= m_upperRight[i]) {
         return false;
       }
     }
@@ -265,8 +322,17 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   /// @brief Get a const reference on the underlying grid structure
   ///
   /// @return grid reference
+  /// @note For mirrored field maps, only the stored part of the grid is
+  ///       returned.
   const Grid& getGrid() const { return m_cfg.grid; }
 
+  /// @brief Get the mirror symmetries of the field map
+  ///
+  /// @return the field component signs for the mirrored grid axes
+  const std::array<std::optional<Vector3>, DIM_POS>& getMirror() const {
+    return m_cfg.mirror;
+  }
+
   /// @copydoc MagneticFieldProvider::makeCache(const MagneticFieldContext&) const
   MagneticFieldProvider::Cache makeCache(
       const MagneticFieldContext& mctx) const final {
@@ -281,32 +347,39 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   /// @pre The given @c position must lie within the range of the underlying
   ///      magnetic field map.
   Result<Vector3> getField(const Vector3& position) const {
-    const auto gridPosition = m_cfg.transformPos(position);
+    auto gridPosition = m_cfg.transformPos(position);
     if (!isInsideLocal(gridPosition)) {
       return Result<Vector3>::failure(MagneticFieldError::OutOfBounds);
     }
+    const unsigned int mask = reflect(gridPosition);
 
-    return Result<Vector3>::success(
-        m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition), position));
+    return Result<Vector3>::success(flip(
+        m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition), position),
+        mask));
   }
 
   Vector3 getFieldUnchecked(const Vector3& position) const final {
-    const auto gridPosition = m_cfg.transformPos(position);
-    return m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition),
-                                 position);
+    auto gridPosition = m_cfg.transformPos(position);
+    const unsigned int mask = reflect(gridPosition);
+    return flip(
+        m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition), position),
+        mask);
   }
 
   /// @copydoc MagneticFieldProvider::getField(const Vector3&,MagneticFieldProvider::Cache&) const
   Result<Vector3> getField(const Vector3& position,
                            MagneticFieldProvider::Cache& cache) const final {
     Cache& lcache = cache.get<Cache>();
-    const auto gridPosition = m_cfg.transformPos(position);
-    if (!lcache.fieldCell || !(*lcache.fieldCell).isInside(gridPosition)) {
+    auto gridPosition = m_cfg.transformPos(position);
+    const unsigned int mask = reflect(gridPosition);
+    if (!lcache.fieldCell || lcache.mirrorMask != mask ||
+        !(*lcache.fieldCell).isInside(gridPosition)) {
       auto res = getFieldCell(position);
       if (!res.ok()) {
         return Result<Vector3>::failure(res.error());
       }
       lcache.fieldCell = *res;
+      lcache.mirrorMask = mask;
     }
     return Result<Vector3>::success((*lcache.fieldCell).getField(gridPosition));
   }
@@ -324,10 +397,37 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   }
 
  private:
+  /// Reflect the grid position onto the stored part of the grid
+  ///
+  /// @param [in,out] gridPosition local N-D position
+  /// @return bit mask of the reflected axes
+  unsigned int reflect(ActsVector<DIM_POS>& gridPosition) const {
+    unsigned int mask = 0;
+    if (m_mirrored) {
+      for (unsigned int i = 0; i < DIM_POS; ++i) {
+        if (m_cfg.mirror[i] && gridPosition[i] < 0) {
+          gridPosition[i] = -gridPosition[i];
+          mask |= 1u << i;
+        }
+      }
+    }
+    return mask;
+  }
+
+  /// Flip the field components for the reflected axes
+  Vector3 flip(const Vector3& field, unsigned int mask) const {
+    return (mask == 0) ? field : Vector3(field.cwiseProduct(m_flips[mask]));
+  }
+
   Config m_cfg;
 
   typename Grid::point_t m_lowerLeft;
   typename Grid::point_t m_upperRight;
+
+  /// whether any grid axis is mirrored
+  bool m_mirrored = false;
+  /// field component signs indexed by the bit mask of reflected axes
+  std::array<Vector3, (1 << DIM_POS)> m_flips;
 };
 
 }  // namespace Acts
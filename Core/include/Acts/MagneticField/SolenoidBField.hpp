@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <vector>
 
 namespace Acts {
 
@@ -67,6 +68,15 @@ namespace Acts {
 ///  z           4pi    __ |  |           2    |  2          1       |
 ///                   |/Rr |_ \   2r(1 - k )   /                    _|
 ///
+/// Optionally, the field can be tabulated at construction. The (r, |z|) plane
+/// inside the configured region is sampled on a regular grid, which is
+/// refined until bilinear interpolation reproduces the analytic field within
+/// the requested tolerance. Queries inside the region are then served by
+/// interpolation, exploiting the symmetry of the field under z -> -z. Grid
+/// cells which do not reach the tolerance at the maximum resolution (e.g.
+/// close to the coils), as well as all positions outside of the region, are
+/// evaluated exactly.
+///
 class SolenoidBField final : public MagneticFieldProvider {
  public:
   struct Cache {
@@ -88,6 +98,16 @@ class SolenoidBField final : public MagneticFieldProvider {
     /// The target magnetic field strength at the center.
     /// This will be used to scale coefficients
     double bMagCenter;
+    /// Maximum absolute deviation of the tabulated from the analytic field.
+    /// If zero (the default), the field is not tabulated and evaluated
+    /// exactly on every call.
+    double tabulationTolerance = 0;
+    /// The tabulated region is 0 <= r < tabulationRMax, |z| < tabulationZMax.
+    /// Both are required to be positive if tabulation is enabled.
+    double tabulationRMax = 0;
+    double tabulationZMax = 0;
+    /// Maximum number of grid bins per axis used during the refinement
+    std::size_t tabulationMaxBins = 1024;
   };
 
   /// @brief the constructor with a shared pointer
@@ -100,6 +120,20 @@ class SolenoidBField final : public MagneticFieldProvider {
   /// @param [in] position local 2D position
   Vector2 getField(const Vector2& position) const;
 
+  /// @brief Retrieve the analytic magnetic field value in local (r,z)
+  /// coordinates, bypassing the tabulation
+  ///
+  /// @param [in] position local 2D position
+  Vector2 getFieldExact(const Vector2& position) const;
+
+  /// @brief Whether the field is served from a precomputed table
+  bool isTabulated() const { return !m_table.empty(); }
+
+  /// @brief Largest deviation between the tabulated and the analytic field
+  /// found during the validation of the table, excluding cells which are
+  /// evaluated exactly
+  double tabulationError() const { return m_tabError; }
+
   /// @copydoc MagneticFieldProvider::makeCache(const MagneticFieldContext&) const
   MagneticFieldProvider::Cache makeCache(
       const MagneticFieldContext& mctx) const override;
@@ -136,6 +170,21 @@ class SolenoidBField final : public MagneticFieldProvider {
   double B_z(const Vector2& pos, double scale) const;
 
   double k2(double r, double z) const;
+
+  /// Build the (r, |z|) table and flag the cells evaluated exactly
+  void tabulate();
+
+  /// Evaluate the field from the table if possible, exactly otherwise
+  Vector2 fieldRZ(const Vector2& pos) const;
+
+  // tabulation, node (ir, iz) is stored at ir * (m_tabNZ + 1) + iz
+  std::size_t m_tabNR = 0;
+  std::size_t m_tabNZ = 0;
+  double m_tabStepR = 0;
+  double m_tabStepZ = 0;
+  double m_tabError = 0;
+  std::vector<Vector2> m_table;
+  std::vector<bool> m_exactCell;
 };
 
 }  // namespace Acts
@@ -14,6 +14,7 @@
 #include "Acts/Utilities/BinUtility.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <vector>
 
@@ -22,8 +23,8 @@ namespace Acts {
 /// @class BinnedSurfaceMaterial
 ///
 /// It extends the @c ISurfaceMaterial base class and is an array pf
-/// MaterialSlab. This is not memory optimised as every bin
-/// holds one material property object.
+/// MaterialSlab. Identical material slabs are stored only once in a palette
+/// and every bin holds the index of its slab in this palette.
 
 class BinnedSurfaceMaterial : public ISurfaceMaterial {
  public:
@@ -64,6 +65,21 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
                         double splitFactor = 0.,
                         MappingType mappingType = MappingType::Default);
 
+  /// Explicit constructor with a palette of MaterialSlab and the palette
+  /// index of every bin.
+  ///
+  /// @param binUtility defines the binning structure on the surface (copied)
+  /// @param palette is the vector of distinct properties (moved)
+  /// @param indices are the palette indices of the bins, ordered with the
+  ///        first bin index running fastest (moved)
+  /// @param splitFactor is the pre/post splitting directive
+  /// @param mappingType is the type of surface mapping associated to the surface
+  BinnedSurfaceMaterial(const BinUtility& binUtility,
+                        MaterialSlabVector palette,
+                        std::vector<std::uint32_t> indices,
+                        double splitFactor = 0.,
+                        MappingType mappingType = MappingType::Default);
+
   /// Copy Move Constructor
   ///
   /// @param bsm is the source object to be copied
@@ -92,7 +108,15 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
   const BinUtility& binUtility() const;
 
   /// @brief Retrieve the entire material slab matrix
-  const MaterialSlabMatrix& fullMaterial() const;
+  ///
+  /// @note The matrix is expanded from the palette on every call
+  MaterialSlabMatrix fullMaterial() const;
+
+  /// @brief Retrieve the distinct material slabs
+  const MaterialSlabVector& palette() const;
+
+  /// @brief Retrieve the palette indices of the bins
+  const std::vector<std::uint32_t>& indices() const;
 
   /// @copydoc ISurfaceMaterial::materialSlab(const Vector2&) const
   const MaterialSlab& materialSlab(const Vector2& lp) const final;
@@ -111,20 +135,31 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
   /// The helper for the bin finding
   BinUtility m_binUtility;
 
-  /// The five different MaterialSlab
-  MaterialSlabMatrix m_fullMaterial;
+  /// The number of bins along the first bin index
+  std::size_t m_nBins0 = 0;
+
+  /// The distinct MaterialSlab
+  MaterialSlabVector m_palette;
+
+  /// The palette index for every bin
+  std::vector<std::uint32_t> m_indices;
 };
 
 inline const BinUtility& BinnedSurfaceMaterial::binUtility() const {
   return (m_binUtility);
 }
 
-inline const MaterialSlabMatrix& BinnedSurfaceMaterial::fullMaterial() const {
-  return m_fullMaterial;
+inline const MaterialSlabVector& BinnedSurfaceMaterial::palette() const {
+  return m_palette;
+}
+
+inline const std::vector<std::uint32_t>& BinnedSurfaceMaterial::indices()
+    const {
+  return m_indices;
 }
 
 inline const MaterialSlab& BinnedSurfaceMaterial::materialSlab(
     std::size_t bin0, std::size_t bin1) const {
-  return m_fullMaterial[bin1][bin0];
+  return m_palette[m_indices[bin0 + m_nBins0 * bin1]];
 }
 }  // namespace Acts
@@ -14,8 +14,13 @@
 #include "Acts/Navigation/NavigationStateUpdaters.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 namespace Acts {
 namespace Experimental {
@@ -119,6 +124,169 @@ class MultiLayerSurfacesUpdaterImpl : public INavigationDelegate {
   }
 };
 
+/// @brief Analytic surface candidates of a regular multi-wire layer
+///
+/// The wires are indexed into a regular 2D grid spanned by two cartesian
+/// axes of the layer frame, perpendicular to the wire direction. Instead of
+/// sampling the path, the track is clipped to the grid extent in the layer
+/// frame and the cells between its entry and exit point are walked in the
+/// order they are crossed. Only the wires indexed in these cells become
+/// candidates, i.e. for a track through a chamber with thousands of tubes
+/// only the few crossed ones (plus the bin expansion) are intersected.
+///
+/// @tparam grid_t is the 2D grid type, usually with equidistant bound axes
+template <typename grid_t>
+class MultiWireSurfacesUpdaterImpl : public INavigationDelegate {
+ public:
+  static_assert(grid_t::DIM == 2u,
+                "MultiWireSurfacesUpdaterImpl: only 2D grids supported");
+
+  /// Broadcast the grid type
+  using grid_type = grid_t;
+
+  /// The grid where the indices are stored
+  grid_type grid;
+
+  /// These are the cast parameters - copied from constructor
+  std::array<BinningValue, grid_type::DIM> casts{};
+
+  /// A transform to be applied to the position
+  Transform3 transform = Transform3::Identity();
+
+  /// @brief Constructor for an analytic multi-wire surface attacher
+  /// @param igrid the grid that is moved into this attacher
+  /// @param icasts is the cast values array, only binX, binY, binZ allowed
+  /// @param itr a transform applied to the global position
+  MultiWireSurfacesUpdaterImpl(
+      grid_type&& igrid, const std::array<BinningValue, grid_type::DIM>& icasts,
+      const Transform3& itr = Transform3::Identity())
+      : grid(std::move(igrid)), casts(icasts), transform(itr) {
+    for (const auto& c : casts) {
+      if (c != binX && c != binY && c != binZ) {
+        throw std::invalid_argument(
+            "MultiWireSurfacesUpdaterImpl: only cartesian binning supported");
+      }
+    }
+  }
+
+  MultiWireSurfacesUpdaterImpl() = delete;
+
+  void update(const GeometryContext& gctx, NavigationState& nState) const {
+    std::vector<std::size_t> indices = crossedIndices(
+        castPosition(nState.position), castDirection(nState.direction));
+    // Wires indexed into several crossed cells only need to be tried once
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+    SurfacesFiller::fill(
+        nState, IndexedSurfacesExtractor::extract(gctx, nState, indices));
+
+    updateCandidates(gctx, nState);
+  }
+
+  /// Cast into a lookup position
+  ///
+  /// @param position is the position of the update call
+  std::array<ActsScalar, grid_type::DIM> castPosition(
+      const Vector3& position) const {
+    Vector3 tposition = transform * position;
+    return {VectorHelpers::cast(tposition, casts[0u]),
+            VectorHelpers::cast(tposition, casts[1u])};
+  }
+
+  /// Cast into a lookup direction
+  ///
+  /// @param direction is the direction of the update call
+  std::array<ActsScalar, grid_type::DIM> castDirection(
+      const Vector3& direction) const {
+    Vector3 tdirection = transform.linear() * direction;
+    return {VectorHelpers::cast(tdirection, casts[0u]),
+            VectorHelpers::cast(tdirection, casts[1u])};
+  }
+
+  /// Collect the surface indices of the cells crossed by a straight line
+  ///
+  /// @param position is the start position in the grid frame
+  /// @param direction is the direction in the grid frame, not normalized
+  ///
+  /// @return the indices of the crossed cells, may contain duplicates
+  std::vector<std::size_t> crossedIndices(
+      const std::array<ActsScalar, 2u>& position,
+      const std::array<ActsScalar, 2u>& direction) const {
+    constexpr ActsScalar inf = std::numeric_limits<ActsScalar>::infinity();
+    const auto min = grid.minPosition();
+    const auto max = grid.maxPosition();
+    const auto width = grid.binWidth();
+    const auto nBins = grid.numLocalBins();
+
+    // Clip the forward part of the line to the grid extent
+    ActsScalar tEntry = 0.;
+    ActsScalar tExit = inf;
+    for (std::size_t i = 0u; i < 2u; ++i) {
+      if (direction[i] == 0.) {
+        if (position[i] < min[i] || position[i] > max[i]) {
+          return {};
+        }
+        continue;
+      }
+      ActsScalar t0 = (min[i] - position[i]) / direction[i];
+      ActsScalar t1 = (max[i] - position[i]) / direction[i];
+      tEntry = std::max(tEntry, std::min(t0, t1));
+      tExit = std::min(tExit, std::max(t0, t1));
+    }
+    if (tEntry > tExit) {
+      return {};
+    }
+
+    // Start cell and the path to its next boundary along each axis
+    std::array<int, 2u> bin{};
+    std::array<int, 2u> step{};
+    std::array<ActsScalar, 2u> tNext{};
+    std::array<ActsScalar, 2u> tDelta{};
+    for (std::size_t i = 0u; i < 2u; ++i) {
+      ActsScalar entry = position[i] + tEntry * direction[i];
+      bin[i] = std::clamp(
+          static_cast<int>(std::floor((entry - min[i]) / width[i])), 0,
+          static_cast<int>(nBins[i]) - 1);
+      if (direction[i] == 0.) {
+        step[i] = 0;
+        tNext[i] = inf;
+        tDelta[i] = inf;
+        continue;
+      }
+      step[i] = direction[i] > 0. ? 1 : -1;
+      ActsScalar boundary =
+          min[i] + (bin[i] + (step[i] > 0 ? 1 : 0)) * width[i];
+      tNext[i] = (boundary - position[i]) / direction[i];
+      tDelta[i] = width[i] / std::abs(direction[i]);
+    }
+
+    // Walk the cells in the order they are crossed, the local bins of the
+    // grid are shifted by one for the underflow bin
+    std::vector<std::size_t> indices;
+    while (true) {
+      const auto& entry = grid.atLocalBins(
+          {static_cast<std::size_t>(bin[0u] + 1),
+           static_cast<std::size_t>(bin[1u] + 1)});
+      indices.insert(indices.end(), entry.begin(), entry.end());
+      // A line parallel to the wires never leaves the start cell
+      if (!std::isfinite(tExit)) {
+        break;
+      }
+      std::size_t i = tNext[0u] < tNext[1u] ? 0u : 1u;
+      if (tNext[i] > tExit) {
+        break;
+      }
+      bin[i] += step[i];
+      if (bin[i] < 0 || bin[i] >= static_cast<int>(nBins[i])) {
+        break;
+      }
+      tNext[i] += tDelta[i];
+    }
+    return indices;
+  }
+};
+
 struct PathGridSurfacesGenerator {
   std::vector<Vector3> operator()(Vector3 startPosition,
                                   const Vector3& direction, ActsScalar stepSize,
@@ -148,6 +148,12 @@ template <typename grid_type>
 using MultiLayerSurfacesImpl =
     MultiLayerSurfacesUpdaterImpl<grid_type, PathGridSurfacesGenerator>;
 
+/// @brief An analytic multi wire surface implementation access
+///
+/// @tparam grid_type is the 2D grid type used for this indexed lookup
+template <typename grid_type>
+using MultiWireSurfacesImpl = MultiWireSurfacesUpdaterImpl<grid_type>;
+
 /// @brief An indexed surface implementation with portal access
 ///
 ///@tparam inexed_updator is the updator for the indexed surfaces
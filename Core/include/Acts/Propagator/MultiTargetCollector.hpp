@@ -0,0 +1,183 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Acts {
+
+/// Actor that records the bound parameters at an ordered sequence of target
+/// surfaces during a single propagation.
+///
+/// The step size is constrained to the next target surface. Once it is
+/// reached, the bound state is computed there, which also transports the
+/// covariance and resets the jacobian, and the propagation continues towards
+/// the following target. This replaces separate propagations from the start
+/// parameters to each of the targets.
+///
+/// The targets have to be ordered along the propagation direction. A target
+/// that is not found ahead of the current position blocks the following ones,
+/// i.e. the propagation then ends at another abort condition.
+struct MultiTargetCollector {
+  /// The target surfaces in the order they are reached
+  std::vector<const Surface*> targets;
+  /// The boundary check for the target intersections
+  BoundaryCheck boundaryCheck = BoundaryCheck(false);
+  /// Whether the covariance is transported to the targets
+  bool transportCov = true;
+  /// Correction for non-linearity effects in the free to bound conversion
+  FreeToBoundCorrection freeToBoundCorrection;
+
+  /// Simple result struct to be returned
+  struct this_result {
+    /// The bound parameters at the reached targets
+    std::vector<BoundTrackParameters> parameters;
+    /// The jacobians from the previous target, or the start, to the targets
+    std::vector<BoundMatrix> jacobians;
+    /// The accumulated path lengths at the targets
+    std::vector<double> pathLengths;
+    /// The index of the next target to be reached
+    std::size_t nextTarget = 0;
+    /// The status of the bound state computation
+    Result<void> result{Result<void>::success()};
+    /// Whether all targets are handled or the collection failed
+    bool finished = false;
+  };
+
+  using result_type = this_result;
+
+  /// Collector action for the ActionList of the Propagator
+  ///
+  /// @tparam propagator_state_t is the type of Propagator state
+  /// @tparam stepper_t Type of the stepper used for the propagation
+  /// @tparam navigator_t Type of the navigator used for the propagation
+  ///
+  /// @param [in,out] state is the mutable propagator state object
+  /// @param [in] stepper The stepper in use
+  /// @param [in] navigator The navigator in use
+  /// @param [in,out] result is the mutable result object
+  /// @param logger a logger instance
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t>
+  void operator()(propagator_state_t& state, const stepper_t& stepper,
+                  const navigator_t& navigator, result_type& result,
+                  const Logger& logger) const {
+    while (result.result.ok() && result.nextTarget < targets.size()) {
+      const Surface& target = *targets[result.nextTarget];
+
+      if (!reached(state, stepper, navigator, target, logger)) {
+        return;
+      }
+
+      auto boundState = stepper.boundState(state.stepping, target, transportCov,
+                                           freeToBoundCorrection);
+      if (!boundState.ok()) {
+        ACTS_ERROR("MultiTargetCollector | Bound state on target "
+                   << result.nextTarget << " failed: " << boundState.error());
+        result.result = boundState.error();
+        break;
+      }
+      auto& [boundParams, jacobian, pathLength] = *boundState;
+      result.parameters.push_back(boundParams);
+      result.jacobians.push_back(jacobian);
+      result.pathLengths.push_back(pathLength);
+      ACTS_VERBOSE("MultiTargetCollector | Target "
+                   << result.nextTarget << " reached at path length "
+                   << pathLength);
+      ++result.nextTarget;
+      // the next target might be further away than the current constraint
+      stepper.releaseStepSize(state.stepping, ConstrainedStep::actor);
+    }
+    result.finished = true;
+  }
+
+ private:
+  /// Check if the target is reached, otherwise constrain the step size to it
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t>
+  bool reached(propagator_state_t& state, const stepper_t& stepper,
+               const navigator_t& navigator, const Surface& target,
+               const Logger& logger) const {
+    if (navigator.currentSurface(state.navigation) == &target) {
+      return true;
+    }
+
+    const double pLimit =
+        state.stepping.stepSize.value(ConstrainedStep::aborter);
+    const double oLimit = stepper.overstepLimit(state.stepping);
+    const double tolerance = state.options.surfaceTolerance;
+
+    const auto sIntersection = target.intersect(
+        state.geoContext, stepper.position(state.stepping),
+        state.options.direction * stepper.direction(state.stepping),
+        boundaryCheck, tolerance);
+
+    if (sIntersection.closest().status() == Intersection3D::Status::onSurface) {
+      return true;
+    }
+
+    for (const auto& intersection : sIntersection.split()) {
+      if (intersection &&
+          detail::checkIntersection(intersection.intersection(), pLimit, oLimit,
+                                    tolerance, logger)) {
+        stepper.updateStepSize(state.stepping, intersection.pathLength(),
+                               ConstrainedStep::actor, false);
+        ACTS_VERBOSE("MultiTargetCollector | Target stepSize updated to "
+                     << stepper.outputStepSize(state.stepping));
+        return false;
+      }
+    }
+
+    ACTS_VERBOSE(
+        "MultiTargetCollector | Target intersection not found. Maybe next "
+        "time?");
+    return false;
+  }
+};
+
+/// Abort condition once all targets of the MultiTargetCollector are reached
+/// or the bound state computation failed
+struct MultiTargetReached {
+  using action_type = MultiTargetCollector;
+
+  /// boolean operator for abort condition using the result
+  ///
+  /// @tparam propagator_state_t Type of the propagator state
+  /// @tparam stepper_t Type of the stepper
+  /// @tparam navigator_t Type of the navigator
+  ///
+  /// @param [in,out] state The propagation state object
+  /// @param [in] navigator Navigator used for propagation
+  /// @param [in] result The result of the MultiTargetCollector
+  /// @param logger a logger instance
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t, typename result_t>
+  bool operator()(propagator_state_t& state, const stepper_t& /*stepper*/,
+                  const navigator_t& navigator, const result_t& result,
+                  const Logger& logger) const {
+    if (result.finished) {
+      ACTS_VERBOSE("MultiTargetReached aborter | All targets handled.");
+      navigator.targetReached(state.navigation, true);
+      return true;
+    }
+    return false;
+  }
+};
+
+}  // namespace Acts
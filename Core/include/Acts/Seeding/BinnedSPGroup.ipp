@@ -8,6 +8,8 @@
 
 // Binned SP Group Iterator
 
+#include <cmath>
+
 #include <boost/container/flat_set.hpp>
 
 template <typename external_spacepoint_t>
@@ -189,6 +191,11 @@ Acts::BinnedSPGroup<external_spacepoint_t>::BinnedSPGroup(
     if (spPhi > phiMax || spPhi < phiMin) {
       continue;
     }
+    // remove SPs outside the optional region of interest
+    if (options.roi != nullptr &&
+        !options.roi->contains(spZ, std::hypot(spX, spY), spPhi)) {
+      continue;
+    }
 
     auto isp = std::make_unique<InternalSpacePoint<external_spacepoint_t>>(
         counter, sp, spPosition, options.beamPos, variance);
@@ -7,6 +7,8 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numeric>
 #include <utility>
 
@@ -65,8 +67,12 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
     topSPIndexVec[i] = i;
   }
 
-  if (topSpVec.size() > 2) {
-    // sort indexes based on comparing values in invHelixDiameterVec
+  // Sort indexes based on comparing values in invHelixDiameterVec. Up to two
+  // top SPs keep their original order, so that the candidates are pushed in
+  // the same order as before; the curvature window then spans all of them and
+  // the curvature is checked for each candidate instead.
+  const bool sortedTops = topSpVec.size() > 2;
+  if (sortedTops) {
     std::sort(
         topSPIndexVec.begin(), topSPIndexVec.end(),
         [&invHelixDiameterVec](const std::size_t i1, const std::size_t i2) {
@@ -74,75 +80,197 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
         });
   }
 
+  // curvature and radius of the top SPs in processing order
+  const std::size_t nTops = topSPIndexVec.size();
+  std::vector<float> sortedInvHelixDiameter(nTops);
+  std::vector<float> sortedTopR(nTops);
+  for (std::size_t k = 0; k < nTops; ++k) {
+    const std::size_t topSPIndex = topSPIndexVec[k];
+    sortedInvHelixDiameter[k] = invHelixDiameterVec[topSPIndex];
+    // use deltaR instead of top radius
+    sortedTopR[k] = m_cfg.useDeltaRorTopRadius
+                        ? spacePointData.deltaR(topSpVec[topSPIndex]->index())
+                        : topSpVec[topSPIndex]->radius();
+  }
+
   // vector containing the radius of all compatible seeds
   std::vector<float> compatibleSeedR;
   compatibleSeedR.reserve(m_cfg.compatSeedLimit);
 
+  // the curvature window [beginCompTopIndex, endCompTopIndex) only moves
+  // forward, as the top SPs are sorted in curvature
   std::size_t beginCompTopIndex = 0;
+  std::size_t endCompTopIndex = sortedTops ? 0 : nTops;
+
+  // Radius search tree of the top SPs in processing order: level l holds the
+  // radii of aligned blocks of 2^l consecutive SPs, each block sorted, up to
+  // a single block of all SPs. It finds the first SP of a range with a radius
+  // inside given limits in O(log^2 n), so the candidates rejected in between
+  // are skipped instead of scanned. The tree is only built once the plain
+  // scan keeps rejecting candidates, which happens when most of them are on
+  // the same layers.
+  constexpr std::size_t kMinRejectedForSearch = 8;
+  std::vector<std::vector<float>> radiusLevels;
+  // blocks still to search as pairs of level and first SP
+  std::vector<std::pair<std::size_t, std::size_t>> searchBlocks;
+  // radii around which no compatible seed can be found
+  std::vector<float> excludedR;
+
+  auto buildRadiusLevels = [&]() {
+    radiusLevels.push_back(sortedTopR);
+    for (std::size_t blockSize = 2; blockSize / 2 < nTops; blockSize *= 2) {
+      const std::vector<float>& lower = radiusLevels.back();
+      std::vector<float> level(nTops);
+      for (std::size_t begin = 0; begin < nTops; begin += blockSize) {
+        const auto first = lower.begin() + begin;
+        const auto middle =
+            lower.begin() + std::min(begin + blockSize / 2, nTops);
+        const auto last = lower.begin() + std::min(begin + blockSize, nTops);
+        std::merge(first, middle, middle, last, level.begin() + begin);
+      }
+      radiusLevels.push_back(std::move(level));
+    }
+  };
+
+  // first SP in [begin, end) with a radius in [lo, hi], end if there is none
+  auto findRadius = [&](std::size_t begin, std::size_t end, float lo,
+                        float hi) {
+    // depth-first through the blocks overlapping the range, left first
+    searchBlocks.clear();
+    searchBlocks.emplace_back(radiusLevels.size() - 1, 0);
+    while (!searchBlocks.empty()) {
+      const auto [level, blockBegin] = searchBlocks.back();
+      searchBlocks.pop_back();
+      const std::size_t blockEnd =
+          std::min(blockBegin + (std::size_t{1} << level), nTops);
+      if (blockEnd <= begin || end <= blockBegin) {
+        continue;
+      }
+      // does the block hold a radius in [lo, hi]
+      const auto first = radiusLevels[level].begin() + blockBegin;
+      const auto last = radiusLevels[level].begin() + blockEnd;
+      if (*first > hi || *(last - 1) < lo ||
+          *std::lower_bound(first, last, lo) > hi) {
+        continue;
+      }
+      if (level == 0) {
+        return blockBegin;
+      }
+      const std::size_t middle = blockBegin + (std::size_t{1} << (level - 1));
+      if (middle < blockEnd) {
+        searchBlocks.emplace_back(level - 1, middle);
+      }
+      searchBlocks.emplace_back(level - 1, blockBegin);
+    }
+    return end;
+  };
+
   // loop over top SPs and other compatible top SP candidates
-  for (const std::size_t topSPIndex : topSPIndexVec) {
+  for (std::size_t sortedIndex = 0; sortedIndex < nTops; ++sortedIndex) {
+    const std::size_t topSPIndex = topSPIndexVec[sortedIndex];
     // if two compatible seeds with high distance in r are found, compatible
     // seeds span 5 layers
     compatibleSeedR.clear();
 
-    float invHelixDiameter = invHelixDiameterVec[topSPIndex];
+    float invHelixDiameter = sortedInvHelixDiameter[sortedIndex];
     float lowerLimitCurv = invHelixDiameter - m_cfg.deltaInvHelixDiameter;
     float upperLimitCurv = invHelixDiameter + m_cfg.deltaInvHelixDiameter;
-    // use deltaR instead of top radius
-    float currentTopR =
-        m_cfg.useDeltaRorTopRadius
-            ? spacePointData.deltaR(topSpVec[topSPIndex]->index())
-            : topSpVec[topSPIndex]->radius();
+    float currentTopR = sortedTopR[sortedIndex];
     float impact = impactParametersVec[topSPIndex];
 
     float weight = -(impact * m_cfg.impactWeightFactor);
 
-    // loop over compatible top SP candidates
-    for (std::size_t variableCompTopIndex = beginCompTopIndex;
-         variableCompTopIndex < topSPIndexVec.size(); variableCompTopIndex++) {
-      std::size_t compatibleTopSPIndex = topSPIndexVec[variableCompTopIndex];
-      if (compatibleTopSPIndex == topSPIndex) {
-        continue;
-      }
+    // slide the curvature window
+    while (sortedTops &&
+           sortedInvHelixDiameter[beginCompTopIndex] < lowerLimitCurv) {
+      ++beginCompTopIndex;
+    }
+    while (endCompTopIndex < nTops &&
+           sortedInvHelixDiameter[endCompTopIndex] <= upperLimitCurv) {
+      ++endCompTopIndex;
+    }
 
-      float otherTopR =
-          m_cfg.useDeltaRorTopRadius
-              ? spacePointData.deltaR(topSpVec[compatibleTopSPIndex]->index())
-              : topSpVec[compatibleTopSPIndex]->radius();
+    // adds the candidate if it is a new compatible seed, returns whether the
+    // compatible seed limit is reached
+    bool compatibleSeedLimit = false;
+    auto checkCandidate = [&](std::size_t compTopIndex) {
+      float otherTopR = sortedTopR[compTopIndex];
 
-      // curvature difference within limits?
-      if (invHelixDiameterVec[compatibleTopSPIndex] < lowerLimitCurv) {
-        // the SPs are sorted in curvature so we skip unnecessary iterations
-        beginCompTopIndex = variableCompTopIndex + 1;
-        continue;
-      }
-      if (invHelixDiameterVec[compatibleTopSPIndex] > upperLimitCurv) {
-        // the SPs are sorted in curvature so we skip unnecessary iterations
-        break;
-      }
       // compared top SP should have at least deltaRMin distance
       float deltaR = currentTopR - otherTopR;
       if (std::abs(deltaR) < m_cfg.deltaRMin) {
-        continue;
+        return false;
       }
-      bool newCompSeed = true;
       for (const float previousDiameter : compatibleSeedR) {
         // original ATLAS code uses higher min distance for 2nd found compatible
         // seed (20mm instead of 5mm)
         // add new compatible seed only if distance larger than rmin to all
         // other compatible seeds
         if (std::abs(previousDiameter - otherTopR) < m_cfg.deltaRMin) {
-          newCompSeed = false;
-          break;
+          return false;
         }
       }
-      if (newCompSeed) {
-        compatibleSeedR.push_back(otherTopR);
-        weight += m_cfg.compatSeedWeight;
+      compatibleSeedR.push_back(otherTopR);
+      weight += m_cfg.compatSeedWeight;
+      compatibleSeedLimit = compatibleSeedR.size() >= m_cfg.compatSeedLimit;
+      return true;
+    };
+
+    // loop over compatible top SP candidates
+    std::size_t nRejected = 0;
+    std::size_t variableCompTopIndex = beginCompTopIndex;
+    for (; variableCompTopIndex < endCompTopIndex && !compatibleSeedLimit &&
+           nRejected < kMinRejectedForSearch;
+         variableCompTopIndex++) {
+      if (variableCompTopIndex == sortedIndex) {
+        continue;
       }
-      if (compatibleSeedR.size() >= m_cfg.compatSeedLimit) {
+      // curvature difference within limits?
+      if (!sortedTops &&
+          (sortedInvHelixDiameter[variableCompTopIndex] < lowerLimitCurv ||
+           sortedInvHelixDiameter[variableCompTopIndex] > upperLimitCurv)) {
+        continue;
+      }
+      if (!checkCandidate(variableCompTopIndex)) {
+        ++nRejected;
+      }
+    }
+
+    // Search the rest of the window only within the radius ranges at least
+    // deltaRMin away from the current top SP and the compatible seeds. The
+    // ranges are widened by a few float epsilons to not miss candidates due
+    // to rounding, the candidates found are checked exactly as above.
+    while (sortedTops && nRejected >= kMinRejectedForSearch &&
+           !compatibleSeedLimit && variableCompTopIndex < endCompTopIndex) {
+      if (radiusLevels.empty()) {
+        buildRadiusLevels();
+      }
+      excludedR.assign(compatibleSeedR.begin(), compatibleSeedR.end());
+      excludedR.push_back(currentTopR);
+      std::sort(excludedR.begin(), excludedR.end());
+
+      std::size_t nextCompTopIndex = endCompTopIndex;
+      float lowR = std::numeric_limits<float>::lowest();
+      for (const float radius : excludedR) {
+        const float margin = 4 * std::numeric_limits<float>::epsilon() *
+                             (std::abs(radius) + std::abs(m_cfg.deltaRMin));
+        const float highR = radius - m_cfg.deltaRMin + margin;
+        if (lowR <= highR) {
+          nextCompTopIndex = findRadius(variableCompTopIndex, nextCompTopIndex,
+                                        lowR, highR);
+        }
+        lowR = radius + m_cfg.deltaRMin - margin;
+      }
+      nextCompTopIndex =
+          findRadius(variableCompTopIndex, nextCompTopIndex, lowR,
+                     std::numeric_limits<float>::max());
+      if (nextCompTopIndex == endCompTopIndex) {
         break;
       }
+      variableCompTopIndex = nextCompTopIndex + 1;
+      if (nextCompTopIndex != sortedIndex) {
+        checkCandidate(nextCompTopIndex);
+      }
     }
 
     if (m_experimentCuts != nullptr) {
@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Seeding/SeedConfirmationRangeConfig.hpp"
+#include "Acts/TrackFinding/RoiDescriptor.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 
 #include <limits>
@@ -276,6 +277,10 @@ struct SeedFinderOptions {
                         0 * Acts::UnitConstants::mm};
   // field induction
   float bFieldInZ = 2.08 * Acts::UnitConstants::T;
+  // optional region of interest. if set, only space points inside of it are
+  // filled into the grid and used for seeding. not owned, the caller has to
+  // keep it alive while seeding
+  const Acts::RoiDescriptor* roi = nullptr;
 
   // derived quantities
   float pTPerHelixRadius = std::numeric_limits<float>::quiet_NaN();
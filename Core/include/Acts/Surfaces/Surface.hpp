@@ -181,6 +181,21 @@ class Surface : public virtual GeometryObject,
   /// @return the contextual transform
   virtual const Transform3& transform(const GeometryContext& gctx) const;
 
+  /// Return method for the inverse of the surface Transform3, i.e. the
+  /// transformation from global into the local frame of the surface
+  ///
+  /// Surface transforms are rigid-body transforms, so the inverse is obtained
+  /// by transposing the rotation instead of a general affine inversion. For
+  /// surfaces without detector element it is computed once and cached, else
+  /// it is forwarded to the detector element, which may cache it per context.
+  ///
+  /// @note Overriding `transform` requires overriding this method as well
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  ///
+  /// @return the contextual inverse transform
+  virtual Transform3 inverseTransform(const GeometryContext& gctx) const;
+
   /// Return method for the surface center by reference
   /// @note the center is always recalculated in order to not keep a cache
   ///
@@ -472,6 +487,9 @@ class Surface : public virtual GeometryObject,
   /// (translation, rotation) the surface in global space
   Transform3 m_transform = Transform3::Identity();
 
+  /// Cached inverse of m_transform, must be updated together with it
+  Transform3 m_inverseTransform = Transform3::Identity();
+
   /// Pointer to the a DetectorElementBase
   const DetectorElementBase* m_associatedDetElement{nullptr};
 
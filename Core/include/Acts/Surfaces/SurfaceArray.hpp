@@ -15,7 +15,11 @@
 #include "Acts/Utilities/IAxis.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <type_traits>
 #include <vector>
 
@@ -170,17 +174,51 @@ class SurfaceArray {
     ///        Surfaces into empty bins
     /// @note This does not always do what you want.
     ///
+    /// The binning positions are sorted along the direction of their
+    /// largest spread. The closest surface of a bin is searched outwards
+    /// from the bin center in this order, until the distance along the
+    /// sorting direction alone exceeds the closest distance found so far.
+    /// Ties are resolved in favour of the surface listed first.
+    ///
     /// @param gctx The current geometry context object, e.g. alignment
     /// @param surfaces The surface pointers to fill
     /// @return number of bins that were filled
     std::size_t completeBinning(const GeometryContext& gctx,
                                 const SurfaceVector& surfaces) override {
       std::size_t binCompleted = 0;
-      std::size_t nBins = size();
-      double minPath = 0;
-      double curPath = 0;
-      const Surface* minSrf = nullptr;
+      if (surfaces.empty()) {
+        return binCompleted;
+      }
+
+      std::vector<Vector3> positions;
+      positions.reserve(surfaces.size());
+      for (const auto& srf : surfaces) {
+        positions.push_back(srf->binningPosition(gctx, binR));
+      }
+
+      Vector3 minPos = positions.front();
+      Vector3 maxPos = positions.front();
+      for (const auto& pos : positions) {
+        minPos = minPos.cwiseMin(pos);
+        maxPos = maxPos.cwiseMax(pos);
+      }
+      Eigen::Index sortAxis = 0;
+      (maxPos - minPos).maxCoeff(&sortAxis);
+
+      std::vector<std::size_t> order(surfaces.size());
+      std::iota(order.begin(), order.end(), 0u);
+      std::stable_sort(order.begin(), order.end(),
+                       [&](std::size_t a, std::size_t b) {
+                         return positions[a][sortAxis] <
+                                positions[b][sortAxis];
+                       });
+      std::vector<double> keys;
+      keys.reserve(order.size());
+      for (std::size_t i : order) {
+        keys.push_back(positions[i][sortAxis]);
+      }
 
+      std::size_t nBins = size();
       for (std::size_t b = 0; b < nBins; ++b) {
         if (!isValidBin(b)) {
           continue;
@@ -192,17 +230,32 @@ class SurfaceArray {
         }
 
         Vector3 binCtr = getBinCenter(b);
-        minPath = std::numeric_limits<double>::max();
-        for (const auto& srf : surfaces) {
-          curPath = (binCtr - srf->binningPosition(gctx, binR)).norm();
-
-          if (curPath < minPath) {
+        double key = binCtr[sortAxis];
+        double minPath = std::numeric_limits<double>::max();
+        std::size_t minIdx = surfaces.size();
+        // returns false once no further surface in this direction can
+        // be closer
+        auto test = [&](std::size_t s) {
+          if (std::abs(keys[s] - key) > minPath) {
+            return false;
+          }
+          std::size_t i = order[s];
+          double curPath = (binCtr - positions[i]).norm();
+          if (curPath < minPath || (curPath == minPath && i < minIdx)) {
             minPath = curPath;
-            minSrf = srf;
+            minIdx = i;
           }
+          return true;
+        };
+
+        std::size_t start =
+            std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+        for (std::size_t s = start; s < keys.size() && test(s); ++s) {
+        }
+        for (std::size_t s = start; s-- > 0 && test(s);) {
         }
 
-        binContent.push_back(minSrf);
+        binContent.push_back(surfaces[minIdx]);
         ++binCompleted;
       }
 
@@ -1512,19 +1512,28 @@ class CombinatorialKalmanFilter {
 
     std::vector<typename TrackContainer::TrackProxy> tracks;
 
+    // Without smoothing or target surface the tracks are returned filtered
+    // only and without parameters, they can be finalized later on using
+    // `smoothTrack` and `extrapolateTrackToReferenceSurface`
+    const bool expectParameters =
+        tfOptions.smoothing && tfOptions.smoothingTargetSurface != nullptr;
+
     for (auto tip : combKalmanResult.lastMeasurementIndices) {
       auto it = combKalmanResult.fittedParameters.find(tip);
-      if (it == combKalmanResult.fittedParameters.end()) {
+      if (expectParameters && it == combKalmanResult.fittedParameters.end()) {
         continue;
       }
 
       auto track = trackContainer.getTrack(trackContainer.addTrack());
       track.tipIndex() = tip;
 
-      const BoundTrackParameters& parameters = it->second;
-      track.parameters() = parameters.parameters();
-      track.covariance() = *parameters.covariance();
-      track.setReferenceSurface(parameters.referenceSurface().getSharedPtr());
+      if (it != combKalmanResult.fittedParameters.end()) {
+        const BoundTrackParameters& parameters = it->second;
+        track.parameters() = parameters.parameters();
+        track.covariance() = *parameters.covariance();
+        track.setReferenceSurface(
+            parameters.referenceSurface().getSharedPtr());
+      }
 
       calculateTrackQuantities(track);
 
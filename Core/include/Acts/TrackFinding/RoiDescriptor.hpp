@@ -9,6 +9,8 @@
 #pragma once
 
 // TODO: update to C++17 style
+#include "Acts/Geometry/Extent.hpp"
+
 #include <atomic>
 #include <iostream>
 #include <map>
@@ -45,6 +47,12 @@ class RoiDescriptor {
                 double zedPlus = s_zedWidthDefault);
   // zedminus - s_zedWidthDefault = 225 //from ROIDescriptor
 
+  /**
+   * @brief constructor for a full scan RoI
+   * @param fullscan flag this RoI as covering the full detector
+   */
+  explicit RoiDescriptor(bool fullscan);
+
   /*
    *  need an explicit class copy constructor
    */
@@ -149,6 +157,22 @@ class RoiDescriptor {
   double rhoMin(double z) const;
   double rhoMax(double z) const;
 
+  /// methods to check whether positions or detector regions are inside the
+  /// RoI; full scan RoIs contain everything and composite RoIs contain
+  /// whatever any of their constituents contains
+
+  /// is the azimuthal angle inside the RoI (handles wrap-around at +-pi)
+  bool containsPhi(double phi) const;
+  /// is the z position at the given radius inside the RoI
+  bool containsZed(double z, double r) const;
+  /// is the global position given in (z, r, phi) inside the RoI
+  bool contains(double z, double r, double phi) const;
+  /// can any position within the extent be inside the RoI
+  ///
+  /// The check is conservative, i.e. it may accept extents that only touch
+  /// the RoI boundaries. Unconstrained extent directions are not checked.
+  bool overlaps(const Extent& extent) const;
+
   static double zedWidthDefault() { return s_zedWidthDefault; }
 
   /// set default z-width (but only before any RoiDescriptor has been created)
@@ -164,6 +188,8 @@ class RoiDescriptor {
   static std::atomic<double> s_zedWidthDefault;
   /// to ensure default width is only set once at job startup
   static std::atomic<bool> s_firstInstanceCreated;
+  /// radius at which the outer z boundaries are evaluated
+  static constexpr double s_rOuter = 1100;
 
   float m_phi{};  //!< phi of RoI center
   float m_eta{};  //!< eta of RoI center
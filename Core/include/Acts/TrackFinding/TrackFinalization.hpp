@@ -0,0 +1,184 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/MultiTrajectoryHelpers.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilterError.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <cmath>
+#include <optional>
+
+namespace Acts {
+
+/// Strategy to select the track state the extrapolation to the reference
+/// surface starts from.
+enum class TrackExtrapolationStrategy {
+  /// Use the first measurement state
+  first,
+  /// Use the last measurement state
+  last,
+  /// Use the measurement state closest to the reference surface
+  firstOrLast,
+};
+
+/// Smooth the track states of a filtered track.
+///
+/// Together with @ref extrapolateTrackToReferenceSurface this allows to run
+/// the track finding without smoothing, and to finalize only the tracks that
+/// are kept, e.g. after the ambiguity resolution.
+///
+/// @tparam track_proxy_t The track proxy type
+/// @tparam smoother_t The smoother type
+///
+/// @param geoContext The geometry context
+/// @param track The track to smooth
+/// @param logger The logger
+/// @param smoother The smoother
+///
+/// @return The result of the smoothing
+template <typename track_proxy_t, typename smoother_t = GainMatrixSmoother>
+Result<void> smoothTrack(const GeometryContext& geoContext,
+                         track_proxy_t& track,
+                         const Logger& logger = getDummyLogger(),
+                         smoother_t smoother = smoother_t()) {
+  auto& trackStateContainer = track.container().trackStateContainer();
+
+  auto smoothingResult =
+      smoother(geoContext, trackStateContainer, track.tipIndex(), logger);
+  if (!smoothingResult.ok()) {
+    ACTS_ERROR("Smoothing track " << track.index() << " failed with error "
+                                  << smoothingResult.error());
+    return smoothingResult.error();
+  }
+
+  return Result<void>::success();
+}
+
+/// Extrapolate a smoothed track to a reference surface and set the result as
+/// the track parameters.
+///
+/// The smoothed parameters of the first or last measurement state are
+/// propagated to the reference surface, the direction is taken from the
+/// intersection of these parameters with the surface.
+///
+/// @tparam track_proxy_t The track proxy type
+/// @tparam propagator_t The propagator type
+/// @tparam propagator_options_t The propagator options type
+///
+/// @param track The smoothed track to extrapolate
+/// @param referenceSurface The reference surface
+/// @param propagator The propagator
+/// @param options The propagator options, the direction is overwritten
+/// @param strategy The state selection strategy
+/// @param logger The logger
+///
+/// @return The result of the extrapolation
+template <typename track_proxy_t, typename propagator_t,
+          typename propagator_options_t>
+Result<void> extrapolateTrackToReferenceSurface(
+    track_proxy_t& track, const Surface& referenceSurface,
+    const propagator_t& propagator, propagator_options_t options,
+    TrackExtrapolationStrategy strategy,
+    const Logger& logger = getDummyLogger()) {
+  const GeometryContext& geoContext = options.geoContext;
+
+  std::optional<typename track_proxy_t::ConstTrackStateProxy> firstState;
+  std::optional<typename track_proxy_t::ConstTrackStateProxy> lastState;
+  for (const auto& trackState : track.trackStatesReversed()) {
+    // Outliers and non-measurement states are excluded as only the smoothing
+    // corrected the very first prediction
+    bool isMeasurement =
+        trackState.typeFlags().test(TrackStateFlag::MeasurementFlag);
+    bool isOutlier = trackState.typeFlags().test(TrackStateFlag::OutlierFlag);
+    if (!isMeasurement || isOutlier || !trackState.hasSmoothed()) {
+      continue;
+    }
+    if (!lastState.has_value()) {
+      lastState = trackState;
+    }
+    firstState = trackState;
+  }
+  if (!firstState.has_value()) {
+    ACTS_ERROR("Track " << track.index()
+                        << " has no smoothed measurement state");
+    return CombinatorialKalmanFilterError::SmoothFailed;
+  }
+
+  auto intersect = [&](const auto& trackState) {
+    FreeVector freeVector =
+        MultiTrajectoryHelpers::freeSmoothed(geoContext, trackState);
+    return referenceSurface
+        .intersect(geoContext, freeVector.segment<3>(eFreePos0),
+                   freeVector.segment<3>(eFreeDir0), BoundaryCheck(false),
+                   options.surfaceTolerance)
+        .closest();
+  };
+
+  const auto firstIntersection = intersect(*firstState);
+  const auto lastIntersection = intersect(*lastState);
+
+  bool useFirstTrackState = true;
+  switch (strategy) {
+    case TrackExtrapolationStrategy::first:
+      useFirstTrackState = true;
+      break;
+    case TrackExtrapolationStrategy::last:
+      useFirstTrackState = false;
+      break;
+    case TrackExtrapolationStrategy::firstOrLast:
+      useFirstTrackState = std::abs(firstIntersection.pathLength()) <=
+                           std::abs(lastIntersection.pathLength());
+      break;
+  }
+
+  const auto& trackState = useFirstTrackState ? *firstState : *lastState;
+  const auto& intersection =
+      useFirstTrackState ? firstIntersection : lastIntersection;
+
+  BoundTrackParameters parameters(trackState.referenceSurface().getSharedPtr(),
+                                  trackState.smoothed(),
+                                  trackState.smoothedCovariance(),
+                                  track.particleHypothesis());
+
+  options.direction = Direction::fromScalarZeroAsPositive(
+      intersection.pathLength());
+
+  auto propagationResult =
+      propagator.propagate(parameters, referenceSurface, options);
+  if (!propagationResult.ok()) {
+    ACTS_ERROR("Extrapolating track " << track.index()
+                                      << " to the reference surface failed: "
+                                      << propagationResult.error() << " "
+                                      << propagationResult.error().message());
+    return propagationResult.error();
+  }
+  if (!propagationResult->endParameters.has_value()) {
+    ACTS_ERROR("Extrapolating track " << track.index()
+                                      << " gave no parameters");
+    return CombinatorialKalmanFilterError::OutputConversionFailed;
+  }
+
+  const auto& endParameters = *propagationResult->endParameters;
+  track.parameters() = endParameters.parameters();
+  track.covariance() = *endParameters.covariance();
+  track.setReferenceSurface(endParameters.referenceSurface().getSharedPtr());
+
+  return Result<void>::success();
+}
+
+}  // namespace Acts
@@ -12,6 +12,9 @@
 
 #include <map>
 #include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -84,6 +87,18 @@ class GaussianTrackDensity {
     State(unsigned int nTracks) { trackEntries.reserve(nTracks); }
     // Vector to cache track information
     std::vector<TrackEntry> trackEntries;
+
+    // The same information in structure of arrays layout, sorted by the lower
+    // bound, which is used to evaluate the density. Only tracks with a lower
+    // bound in (z - maxWindow, z) can contribute at a position z.
+    std::vector<double> z;
+    std::vector<double> c0;
+    std::vector<double> c1;
+    std::vector<double> c2;
+    std::vector<double> lowerBound;
+    std::vector<double> upperBound;
+    // Largest distance between the lower and upper bound of a track
+    double maxWindow = 0;
   };
 
   /// Default constructor
@@ -129,6 +144,25 @@ class GaussianTrackDensity {
                        const std::function<BoundTrackParameters(input_track_t)>&
                            extractParameters) const;
 
+  /// @brief Calculates the z positions and Gaussian widths of the distinct
+  /// local maxima of the density function in a single pass.
+  ///
+  /// Uses the same search as globalMaximumWithWidth, starting from every
+  /// track, but keeps the best position found from each start. Positions
+  /// within the Gaussian width of a more prominent maximum are considered to
+  /// belong to it. The first element is the global maximum.
+  ///
+  /// @param state The track density state
+  /// @param trackList All input tracks
+  /// @param extractParameters Function extracting BoundTrackParameters from
+  /// InputTrack
+  ///
+  /// @return Pairs of position and Gaussian width, by decreasing density
+  std::vector<std::pair<double, double>> localMaximaWithWidth(
+      State& state, const std::vector<const input_track_t*>& trackList,
+      const std::function<BoundTrackParameters(input_track_t)>&
+          extractParameters) const;
+
  private:
   /// The configuration
   Config m_cfg;
@@ -154,6 +188,16 @@ class GaussianTrackDensity {
   std::tuple<double, double, double> trackDensityAndDerivatives(State& state,
                                                                 double z) const;
 
+  /// @brief Search for a maximum starting from every track
+  ///
+  /// @param state The track density state with all tracks added
+  ///
+  /// @return Position, density and second derivative of the best point found
+  /// from each start, in the order of the tracks. Starts that did not find a
+  /// maximum are omitted.
+  std::vector<std::tuple<double, double, double>> searchMaxima(
+      State& state) const;
+
   /// @brief Update the current maximum values
   ///
   /// @param newZ The new z value
@@ -176,28 +220,6 @@ class GaussianTrackDensity {
   ///
   /// @return The step size
   double stepSize(double y, double dy, double ddy) const;
-
-  // Helper class to evaluate and store track density at specific position
-  class GaussianTrackDensityStore {
-   public:
-    // Initialise at the z coordinate at which the density is to be evaluated
-    GaussianTrackDensityStore(double z_coordinate) : m_z(z_coordinate) {}
-
-    // Add the contribution of a single track to the density
-    void addTrackToDensity(const TrackEntry& entry);
-
-    // Return density, first and second derivatives
-    inline std::tuple<double, double, double> densityAndDerivatives() const {
-      return {m_density, m_firstDerivative, m_secondDerivative};
-    }
-
-   private:
-    // Store density and derivatives for z position m_z
-    double m_z;
-    double m_density{0};
-    double m_firstDerivative{0};
-    double m_secondDerivative{0};
-  };
 };
 
 }  // namespace Acts
@@ -8,6 +8,8 @@
 
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <math.h>
 
 namespace Acts {
@@ -27,37 +29,10 @@ Acts::GaussianTrackDensity<input_track_t>::globalMaximumWithWidth(
   double maxDensity = 0.;
   double maxSecondDerivative = 0.;
 
-  for (const auto& track : state.trackEntries) {
-    double trialZ = track.z;
-
-    auto [density, firstDerivative, secondDerivative] =
-        trackDensityAndDerivatives(state, trialZ);
-    if (secondDerivative >= 0. || density <= 0.) {
-      continue;
-    }
-    std::tie(maxPosition, maxDensity, maxSecondDerivative) =
-        updateMaximum(trialZ, density, secondDerivative, maxPosition,
-                      maxDensity, maxSecondDerivative);
-
-    trialZ += stepSize(density, firstDerivative, secondDerivative);
-    std::tie(density, firstDerivative, secondDerivative) =
-        trackDensityAndDerivatives(state, trialZ);
-
-    if (secondDerivative >= 0. || density <= 0.) {
-      continue;
-    }
-    std::tie(maxPosition, maxDensity, maxSecondDerivative) =
-        updateMaximum(trialZ, density, secondDerivative, maxPosition,
-                      maxDensity, maxSecondDerivative);
-    trialZ += stepSize(density, firstDerivative, secondDerivative);
-    std::tie(density, firstDerivative, secondDerivative) =
-        trackDensityAndDerivatives(state, trialZ);
-    if (secondDerivative >= 0. || density <= 0.) {
-      continue;
-    }
+  for (const auto& [z, density, secondDerivative] : searchMaxima(state)) {
     std::tie(maxPosition, maxDensity, maxSecondDerivative) =
-        updateMaximum(trialZ, density, secondDerivative, maxPosition,
-                      maxDensity, maxSecondDerivative);
+        updateMaximum(z, density, secondDerivative, maxPosition, maxDensity,
+                      maxSecondDerivative);
   }
 
   return (maxSecondDerivative == 0.)
@@ -74,6 +49,75 @@ double Acts::GaussianTrackDensity<input_track_t>::globalMaximum(
   return globalMaximumWithWidth(state, trackList, extractParameters).first;
 }
 
+template <typename input_track_t>
+std::vector<std::pair<double, double>>
+Acts::GaussianTrackDensity<input_track_t>::localMaximaWithWidth(
+    State& state, const std::vector<const input_track_t*>& trackList,
+    const std::function<BoundTrackParameters(input_track_t)>& extractParameters)
+    const {
+  std::vector<std::pair<double, double>> maxima;
+
+  auto result = addTracks(state, trackList, extractParameters);
+  if (!result.ok()) {
+    return maxima;
+  }
+
+  auto candidates = searchMaxima(state);
+  // most prominent first, ties keep the track order like the global search
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const auto& a, const auto& b) {
+                     return std::get<1>(a) > std::get<1>(b);
+                   });
+
+  for (const auto& [z, density, secondDerivative] : candidates) {
+    const double width = std::sqrt(-(density / secondDerivative));
+    const bool known =
+        std::any_of(maxima.begin(), maxima.end(), [&](const auto& maximum) {
+          return std::abs(z - maximum.first) < maximum.second;
+        });
+    if (!known) {
+      maxima.emplace_back(z, width);
+    }
+  }
+
+  return maxima;
+}
+
+template <typename input_track_t>
+std::vector<std::tuple<double, double, double>>
+Acts::GaussianTrackDensity<input_track_t>::searchMaxima(State& state) const {
+  std::vector<std::tuple<double, double, double>> maxima;
+  maxima.reserve(state.trackEntries.size());
+
+  for (const auto& track : state.trackEntries) {
+    double trialZ = track.z;
+
+    double maxPosition = 0.;
+    double maxDensity = 0.;
+    double maxSecondDerivative = 0.;
+
+    // evaluate at the track position and take up to two steps towards the
+    // nearest maximum, as long as the density is curved downwards
+    for (unsigned int iStep = 0; iStep < 3; ++iStep) {
+      auto [density, firstDerivative, secondDerivative] =
+          trackDensityAndDerivatives(state, trialZ);
+      if (secondDerivative >= 0. || density <= 0.) {
+        break;
+      }
+      std::tie(maxPosition, maxDensity, maxSecondDerivative) =
+          updateMaximum(trialZ, density, secondDerivative, maxPosition,
+                        maxDensity, maxSecondDerivative);
+      trialZ += stepSize(density, firstDerivative, secondDerivative);
+    }
+
+    if (maxDensity > 0.) {
+      maxima.emplace_back(maxPosition, maxDensity, maxSecondDerivative);
+    }
+  }
+
+  return maxima;
+}
+
 template <typename input_track_t>
 Result<void> Acts::GaussianTrackDensity<input_track_t>::addTracks(
     State& state, const std::vector<const input_track_t*>& trackList,
@@ -127,6 +171,41 @@ Result<void> Acts::GaussianTrackDensity<input_track_t>::addTracks(
     state.trackEntries.emplace_back(z0, constantTerm, linearTerm, quadraticTerm,
                                     zMin, zMax);
   }
+
+  // fill the structure of arrays sorted by the lower bound. the remaining
+  // members only break ties so that the evaluation order does not depend on
+  // the order of the input tracks
+  std::vector<const TrackEntry*> sorted;
+  sorted.reserve(state.trackEntries.size());
+  for (const auto& entry : state.trackEntries) {
+    sorted.push_back(&entry);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const TrackEntry* a, const TrackEntry* b) {
+              return std::tie(a->lowerBound, a->upperBound, a->z, a->c0) <
+                     std::tie(b->lowerBound, b->upperBound, b->z, b->c0);
+            });
+
+  state.z.clear();
+  state.c0.clear();
+  state.c1.clear();
+  state.c2.clear();
+  state.lowerBound.clear();
+  state.upperBound.clear();
+  state.maxWindow = 0;
+  for (const TrackEntry* entry : sorted) {
+    state.z.push_back(entry->z);
+    state.c0.push_back(entry->c0);
+    state.c1.push_back(entry->c1);
+    state.c2.push_back(entry->c2);
+    state.lowerBound.push_back(entry->lowerBound);
+    state.upperBound.push_back(entry->upperBound);
+    state.maxWindow =
+        std::max(state.maxWindow, entry->upperBound - entry->lowerBound);
+  }
+  // guard against rounding when selecting the tracks by their lower bound
+  state.maxWindow *= 1.001;
+
   return Result<void>::success();
 }
 
@@ -134,11 +213,39 @@ template <typename input_track_t>
 std::tuple<double, double, double>
 Acts::GaussianTrackDensity<input_track_t>::trackDensityAndDerivatives(
     State& state, double z) const {
-  GaussianTrackDensityStore densityResult(z);
-  for (const auto& trackEntry : state.trackEntries) {
-    densityResult.addTrackToDensity(trackEntry);
+  // only tracks with lowerBound < z < upperBound contribute. the lower bound
+  // is sorted and no track is wider than the maximum window, so the
+  // candidates form a contiguous range
+  const auto lowerBegin = state.lowerBound.begin();
+  const auto lowerEnd = state.lowerBound.end();
+  const std::size_t begin =
+      std::upper_bound(lowerBegin, lowerEnd, z - state.maxWindow) - lowerBegin;
+  const std::size_t end =
+      std::lower_bound(lowerBegin + begin, lowerEnd, z) - lowerBegin;
+
+  const double* c0 = state.c0.data();
+  const double* c1 = state.c1.data();
+  const double* c2 = state.c2.data();
+  const double* upperBound = state.upperBound.data();
+
+  double density = 0;
+  double firstDerivative = 0;
+  double secondDerivative = 0;
+  // the exponential is evaluated for every candidate and the upper bound is
+  // applied as a mask afterwards, which keeps the loop free of control flow.
+  // beyond the upper bound the exponent only decreases, so the masked terms
+  // are finite.
+  for (std::size_t i = begin; i < end; ++i) {
+    const double exponent = c0[i] + z * (c1[i] + z * c2[i]);
+    const double mask = (z < upperBound[i]) ? 1. : 0.;
+    const double delta = mask * std::exp(exponent);
+    const double qPrime = c1[i] + 2. * z * c2[i];
+    const double deltaPrime = delta * qPrime;
+    density += delta;
+    firstDerivative += deltaPrime;
+    secondDerivative += 2. * c2[i] * delta + qPrime * deltaPrime;
   }
-  return densityResult.densityAndDerivatives();
+  return {density, firstDerivative, secondDerivative};
 }
 
 template <typename input_track_t>
@@ -160,18 +267,4 @@ double Acts::GaussianTrackDensity<input_track_t>::stepSize(double y, double dy,
   return (m_cfg.isGaussianShaped ? (y * dy) / (dy * dy - y * ddy) : -dy / ddy);
 }
 
-template <typename input_track_t>
-void Acts::GaussianTrackDensity<input_track_t>::GaussianTrackDensityStore::
-    addTrackToDensity(const TrackEntry& entry) {
-  // Take track only if it's within bounds
-  if (entry.lowerBound < m_z && m_z < entry.upperBound) {
-    double delta = std::exp(entry.c0 + m_z * (entry.c1 + m_z * entry.c2));
-    double qPrime = entry.c1 + 2. * m_z * entry.c2;
-    double deltaPrime = delta * qPrime;
-    m_density += delta;
-    m_firstDerivative += deltaPrime;
-    m_secondDerivative += 2. * entry.c2 * delta + qPrime * deltaPrime;
-  }
-}
-
 }  // namespace Acts
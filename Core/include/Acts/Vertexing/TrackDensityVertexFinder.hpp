@@ -48,6 +48,10 @@ class TrackDensityVertexFinder {
   struct Config {
     // The track density estimator
     track_density_t trackDensityEstimator;
+    // Maximum number of seeds returned per call. If larger than one, the
+    // distinct local maxima of the density are returned, ordered by
+    // increasing density such that the most prominent seed is the last one.
+    std::size_t maxNumberOfSeeds = 1;
   };
 
   /// State struct for fulfilling interface
@@ -60,7 +64,8 @@ class TrackDensityVertexFinder {
   /// @param state State for fulfilling interfaces
   ///
   /// @return Vector of vertices, filled with a single
-  ///         vertex (for consistent interfaces)
+  ///         vertex (for consistent interfaces) unless
+  ///         Config::maxNumberOfSeeds is larger than one
   Result<std::vector<Vertex<InputTrack_t>>> find(
       const std::vector<const InputTrack_t*>& trackVector,
       const VertexingOptions<InputTrack_t>& vertexingOptions,
@@ -6,6 +6,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+
 template <typename vfitter_t, typename track_density_t>
 auto Acts::TrackDensityVertexFinder<vfitter_t, track_density_t>::find(
     const std::vector<const InputTrack_t*>& trackVector,
@@ -13,30 +15,46 @@ auto Acts::TrackDensityVertexFinder<vfitter_t, track_density_t>::find(
     State& /*state*/) const -> Result<std::vector<Vertex<InputTrack_t>>> {
   typename track_density_t::State densityState(trackVector.size());
 
-  // Calculate z seed position
-  std::pair<double, double> zAndWidth =
-      m_cfg.trackDensityEstimator.globalMaximumWithWidth(
-          densityState, trackVector, m_extractParameters);
+  // Calculate z seed positions, the most prominent one is the last
+  std::vector<std::pair<double, double>> zAndWidths;
+  if (m_cfg.maxNumberOfSeeds > 1) {
+    zAndWidths = m_cfg.trackDensityEstimator.localMaximaWithWidth(
+        densityState, trackVector, m_extractParameters);
+    if (zAndWidths.size() > m_cfg.maxNumberOfSeeds) {
+      zAndWidths.resize(m_cfg.maxNumberOfSeeds);
+    }
+    std::reverse(zAndWidths.begin(), zAndWidths.end());
+    // same fallback as the global maximum search
+    if (zAndWidths.empty()) {
+      zAndWidths.emplace_back(0., 0.);
+    }
+  } else {
+    zAndWidths.push_back(m_cfg.trackDensityEstimator.globalMaximumWithWidth(
+        densityState, trackVector, m_extractParameters));
+  }
 
-  double z = zAndWidth.first;
+  std::vector<Vertex<InputTrack_t>> seedVec;
+  seedVec.reserve(zAndWidths.size());
 
-  // Calculate seed position
-  // Note: constraint position is (0,0,0) if no constraint provided
-  Vector4 seedPos =
-      vertexingOptions.constraint.fullPosition() + Vector4(0., 0., z, 0.);
+  for (const auto& [z, width] : zAndWidths) {
+    // Calculate seed position
+    // Note: constraint position is (0,0,0) if no constraint provided
+    Vector4 seedPos =
+        vertexingOptions.constraint.fullPosition() + Vector4(0., 0., z, 0.);
 
-  Vertex<InputTrack_t> returnVertex = Vertex<InputTrack_t>(seedPos);
+    Vertex<InputTrack_t> returnVertex = Vertex<InputTrack_t>(seedPos);
 
-  SquareMatrix4 seedCov = vertexingOptions.constraint.fullCovariance();
+    SquareMatrix4 seedCov = vertexingOptions.constraint.fullCovariance();
 
-  // Check if a constraint is provided and set the new z position constraint
-  if (seedCov != SquareMatrix4::Zero() && std::isnormal(zAndWidth.second)) {
-    seedCov(eZ, eZ) = zAndWidth.second * zAndWidth.second;
-  }
+    // Check if a constraint is provided and set the new z position constraint
+    if (seedCov != SquareMatrix4::Zero() && std::isnormal(width)) {
+      seedCov(eZ, eZ) = width * width;
+    }
 
-  returnVertex.setFullCovariance(seedCov);
+    returnVertex.setFullCovariance(seedCov);
 
-  std::vector<Vertex<InputTrack_t>> seedVec{returnVertex};
+    seedVec.push_back(returnVertex);
+  }
 
   return seedVec;
 }
@@ -11,10 +11,14 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Geometry/AbstractVolume.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Polyhedron.hpp"
 #include "Acts/Visualization/IVisualization3D.hpp"
 #include "Acts/Visualization/ViewConfig.hpp"
 
+#include <cstddef>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace Acts {
 
@@ -22,7 +26,6 @@ class Layer;
 class Surface;
 class SurfaceArray;
 class TrackingVolume;
-struct Polyhedron;
 class AbstractVolume;
 class IVisualization3D;
 
@@ -38,6 +41,26 @@ static const ViewConfig s_viewGrid;
 static const ViewConfig s_viewLine;
 
 struct GeometryView3D {
+  /// Cache for the tessellation of planar surfaces in their local frame.
+  ///
+  /// Detectors consist of many modules with identical bounds, which then only
+  /// need to be tessellated once and are placed with their transform. The
+  /// drawing methods create one for each call if none is given, pass the
+  /// same cache to share it across several calls of an export.
+  class TessellationCache {
+   public:
+    /// Polyhedron representation of the surface in the global frame
+    ///
+    /// @param surface The surface to be tessellated
+    /// @param gctx The geometry context for which it is drawn
+    /// @param nSegments The number of segments for curved bounds
+    Polyhedron polyhedron(const Surface& surface, const GeometryContext& gctx,
+                          std::size_t nSegments);
+
+   private:
+    std::map<std::vector<double>, Polyhedron> m_local;
+  };
+
   /// Helper method to draw Polyhedron objects
   ///
   /// @param [in,out] helper The visualization helper
@@ -69,6 +92,7 @@ struct GeometryView3D {
   /// @param passiveConfig The drawing configuration for passive surfaces
   /// @param gridConfig The drawing configuration for grid
   /// @param outputDir Directory to write to
+  /// @param cache The (optional) tessellation cache to be used
   static void drawSurfaceArray(
       IVisualization3D& helper, const SurfaceArray& surfaceArray,
       const GeometryContext& gctx,
@@ -76,7 +100,7 @@ struct GeometryView3D {
       const ViewConfig& sensitiveConfig = s_viewSensitive,
       const ViewConfig& passiveConfig = s_viewPassive,
       const ViewConfig& gridConfig = s_viewGrid,
-      const std::string& outputDir = ".");
+      const std::string& outputDir = ".", TessellationCache* cache = nullptr);
 
   /// Helper method to draw AbstractVolume objects
   ///
@@ -115,6 +139,7 @@ struct GeometryView3D {
   /// @param connected The config for connected portals
   /// @param unconnected The config for unconnected portals
   /// @param viewConfig The drawing configuration
+  /// @param cache The (optional) tessellation cache to be used
   static void drawDetectorVolume(
       IVisualization3D& helper,
       const Acts::Experimental::DetectorVolume& volume,
@@ -122,7 +147,8 @@ struct GeometryView3D {
       const Transform3& transform = Transform3::Identity(),
       const ViewConfig& connected = ViewConfig({0, 255, 0}),
       const ViewConfig& unconnected = ViewConfig({255, 0, 0}),
-      const ViewConfig& viewConfig = s_viewSensitive);
+      const ViewConfig& viewConfig = s_viewSensitive,
+      TessellationCache* cache = nullptr);
 
   /// Helper method to draw AbstractVolume objects
   ///
@@ -133,12 +159,14 @@ struct GeometryView3D {
   /// @param sensitiveConfig The drawing configuration for sensitive surfaces
   /// @param gridConfig The drawing configuration for grid display
   /// @param outputDir Directory to write to
+  /// @param cache The (optional) tessellation cache to be used
   static void drawLayer(IVisualization3D& helper, const Layer& layer,
                         const GeometryContext& gctx,
                         const ViewConfig& layerConfig = s_viewPassive,
                         const ViewConfig& sensitiveConfig = s_viewSensitive,
                         const ViewConfig& gridConfig = s_viewGrid,
-                        const std::string& outputDir = ".");
+                        const std::string& outputDir = ".",
+                        TessellationCache* cache = nullptr);
 
   /// Helper method to draw AbstractVolume objects
   ///
@@ -154,6 +182,7 @@ struct GeometryView3D {
   /// @param writeIt The prescription to write it or not
   /// @param tag The (optional) additional output tag
   /// @param outputDir Directory to write to
+  /// @param cache The (optional) tessellation cache to be used
   static void drawTrackingVolume(
       IVisualization3D& helper, const TrackingVolume& tVolume,
       const GeometryContext& gctx,
@@ -162,7 +191,8 @@ struct GeometryView3D {
       const ViewConfig& layerView = s_viewPassive,
       const ViewConfig& sensitiveView = s_viewSensitive,
       const ViewConfig& gridView = s_viewGrid, bool writeIt = true,
-      const std::string& tag = "", const std::string& outputDir = ".");
+      const std::string& tag = "", const std::string& outputDir = ".",
+      TessellationCache* cache = nullptr);
 
   /// Helper method to draw lines - base for all lines
   ///
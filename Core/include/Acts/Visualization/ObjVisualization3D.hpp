@@ -16,6 +16,7 @@
 #include <fstream>
 #include <iomanip>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -72,10 +73,37 @@ class ObjVisualization3D : public IVisualization3D {
   /// @param mos the output stream for the auxiliary material file
   void write(std::ostream& os, std::ostream& mos) const;
 
+  /// Open the object and the material file for a path, as in
+  /// `write(const std::string&)`, to be filled with `flush`
+  ///
+  /// @param path the output path, `.obj` is appended if it has no extension
+  /// @param os the output stream for the object
+  /// @param mos the output stream for the auxiliary material file
+  void open(const std::string& path, std::ofstream& os,
+            std::ofstream& mos) const;
+
+  /// Write the buffered content to the streams and release it
+  ///
+  /// The vertex numbering continues across consecutive calls, such that all
+  /// chunks written to the same streams form a single valid object file.
+  /// This allows large scenes to be written with bounded memory.
+  ///
+  /// @param os the output stream for the object
+  /// @param mos the output stream for the auxiliary material file
+  void flush(std::ostream& os, std::ostream& mos);
+
   ///  @copydoc Acts::IVisualization3D::clear()
   void clear() final;
 
  private:
+  /// Write the buffered content with the given set of already defined
+  /// materials
+  void write(std::ostream& os, std::ostream& mos,
+             std::set<std::string>& materials) const;
+
+  /// Register a color change of the vertex stream
+  void setVertexColor(ColorRGB color);
+
   /// The output parameters
   unsigned int m_outputPrecision = 4;
   double m_outputScalor = 1.;
@@ -87,6 +115,12 @@ class ObjVisualization3D : public IVisualization3D {
   std::map<std::size_t, ColorRGB> m_lineColors;
   std::map<std::size_t, ColorRGB> m_vertexColors;
   std::map<std::size_t, ColorRGB> m_faceColors;
+  /// Color of the last registered vertex color change
+  ColorRGB m_lastVertexColor = {0, 0, 0};
+  /// Number of vertices already flushed
+  std::size_t m_vertexOffset = 0;
+  /// Materials already flushed
+  std::set<std::string> m_materials;
 };
 
 #ifndef DOXYGEN
@@ -6,9 +6,18 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+template <typename T>
+void ObjVisualization3D<T>::setVertexColor(ColorRGB color) {
+  // only changes of the color are relevant for the output
+  if (color != m_lastVertexColor) {
+    m_vertexColors[m_vertices.size()] = color;
+    m_lastVertexColor = color;
+  }
+}
+
 template <typename T>
 void ObjVisualization3D<T>::vertex(const Vector3& vtx, ColorRGB color) {
-  m_vertexColors[m_vertices.size()] = color;
+  setVertexColor(color);
   m_vertices.push_back(vtx.template cast<ValueType>());
 }
 
@@ -21,7 +30,8 @@ void ObjVisualization3D<T>::line(const Vector3& a, const Vector3& b,
   // not implemented
   vertex(a, color);
   vertex(b, color);
-  m_lines.push_back({m_vertices.size() - 2, m_vertices.size() - 1});
+  m_lines.push_back({m_vertexOffset + m_vertices.size() - 2,
+                     m_vertexOffset + m_vertices.size() - 1});
 }
 
 template <typename T>
@@ -34,7 +44,7 @@ void ObjVisualization3D<T>::face(const std::vector<Vector3>& vtxs,
   idxs.reserve(vtxs.size());
   for (const auto& vtx : vtxs) {
     vertex(vtx, color);
-    idxs.push_back(m_vertices.size() - 1);
+    idxs.push_back(m_vertexOffset + m_vertices.size() - 1);
   }
   m_faces.push_back(std::move(idxs));
 }
@@ -50,11 +60,14 @@ void ObjVisualization3D<T>::faces(const std::vector<Vector3>& vtxs,
     if (color != ColorRGB{0, 0, 0}) {
       m_faceColors[m_faces.size()] = color;
     }
-    auto vtxoffs = m_vertices.size();
+    auto vtxoffs = m_vertexOffset + m_vertices.size();
     if (color != ColorRGB{0, 0, 0}) {
-      m_vertexColors[m_vertices.size()] = color;
+      setVertexColor(color);
+    }
+    m_vertices.reserve(m_vertices.size() + vtxs.size());
+    for (const auto& vtx : vtxs) {
+      m_vertices.push_back(vtx.template cast<ValueType>());
     }
-    m_vertices.insert(m_vertices.end(), vtxs.begin(), vtxs.end());
     for (const auto& face : faces) {
       if (face.size() == 2) {
         m_lines.push_back({face[0] + vtxoffs, face[2] + vtxoffs});
@@ -71,6 +84,16 @@ void ObjVisualization3D<T>::faces(const std::vector<Vector3>& vtxs,
 template <typename T>
 void ObjVisualization3D<T>::write(const std::string& path) const {
   std::ofstream os;
+  std::ofstream mtlos;
+  open(path, os, mtlos);
+  write(os, mtlos);
+  os.close();
+  mtlos.close();
+}
+
+template <typename T>
+void ObjVisualization3D<T>::open(const std::string& path, std::ofstream& os,
+                                 std::ofstream& mos) const {
   std::string objectpath = path;
   if (!IVisualization3D::hasExtension(objectpath)) {
     objectpath += std::string(".obj");
@@ -79,11 +102,7 @@ void ObjVisualization3D<T>::write(const std::string& path) const {
   std::string mtlpath = objectpath;
   IVisualization3D::replaceExtension(mtlpath, ".mtl");
   os << "mtllib " << mtlpath << "\n";
-  std::ofstream mtlos;
-  mtlos.open(mtlpath);
-  write(os, mtlos);
-  os.close();
-  mtlos.close();
+  mos.open(mtlpath);
 }
 
 template <typename T>
@@ -94,8 +113,26 @@ void ObjVisualization3D<T>::write(std::ostream& os) const {
 
 template <typename T>
 void ObjVisualization3D<T>::write(std::ostream& os, std::ostream& mos) const {
-  std::map<std::string, bool> materials;
+  std::set<std::string> materials = m_materials;
+  write(os, mos, materials);
+}
 
+template <typename T>
+void ObjVisualization3D<T>::flush(std::ostream& os, std::ostream& mos) {
+  write(os, mos, m_materials);
+  m_vertexOffset += m_vertices.size();
+  m_vertices.clear();
+  m_faces.clear();
+  m_lines.clear();
+  m_lineColors.clear();
+  m_vertexColors.clear();
+  m_faceColors.clear();
+  m_lastVertexColor = {0, 0, 0};
+}
+
+template <typename T>
+void ObjVisualization3D<T>::write(std::ostream& os, std::ostream& mos,
+                                  std::set<std::string>& materials) const {
   auto mixColor = [&](const ColorRGB& color) -> std::string {
     std::string materialName;
     materialName = "material_";
@@ -113,6 +150,7 @@ void ObjVisualization3D<T>::write(std::ostream& os, std::ostream& mos) const {
             << "\n";
       }
       mos << "\n";
+      materials.insert(materialName);
     }
     return std::string("usemtl ") + materialName;
   };
@@ -173,4 +211,7 @@ void ObjVisualization3D<T>::clear() {
   m_lineColors.clear();
   m_vertexColors.clear();
   m_faceColors.clear();
+  m_lastVertexColor = {0, 0, 0};
+  m_vertexOffset = 0;
+  m_materials.clear();
 }
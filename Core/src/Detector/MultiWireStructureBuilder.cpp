@@ -45,6 +45,9 @@ class MultiWireInternalStructureBuilder
 
     /// The transform into the local binning schema
     Acts::Transform3 transform = Acts::Transform3::Identity();
+
+    /// Compute the crossed wires analytically instead of sampling the path
+    bool analyticNavigation = true;
   };
 
   // Constructor
@@ -67,12 +70,6 @@ class MultiWireInternalStructureBuilder
         Acts::Experimental::tryNoVolumes();
     // Create the indexed surfaces
     auto internalSurfaces = m_cfg.iSurfaces;
-    Acts::Experimental::detail::IndexedSurfacesGenerator<
-        decltype(internalSurfaces), Acts::Experimental::MultiLayerSurfacesImpl>
-        isg{internalSurfaces,
-            {},
-            {m_cfg.binning[0u].binValue, m_cfg.binning[1u].binValue},
-            {m_cfg.binning[0u].expansion, m_cfg.binning[1u].expansion}};
     Acts::Experimental::detail::CenterReferenceGenerator rGenerator;
     Acts::Experimental::detail::GridAxisGenerators::EqBoundEqBound aGenerator{
         {m_cfg.binning[0u].edges.front(), m_cfg.binning[0u].edges.back()},
@@ -80,7 +77,25 @@ class MultiWireInternalStructureBuilder
         {m_cfg.binning[1u].edges.front(), m_cfg.binning[1u].edges.back()},
         m_cfg.binning[1u].edges.size() - 1};
 
-    auto sfCandidatesUpdater = isg(gctx, aGenerator, rGenerator);
+    Acts::Experimental::SurfaceCandidatesUpdater sfCandidatesUpdater;
+    if (m_cfg.analyticNavigation) {
+      Acts::Experimental::detail::IndexedSurfacesGenerator<
+          decltype(internalSurfaces), Acts::Experimental::MultiWireSurfacesImpl>
+          isg{internalSurfaces,
+              {},
+              {m_cfg.binning[0u].binValue, m_cfg.binning[1u].binValue},
+              {m_cfg.binning[0u].expansion, m_cfg.binning[1u].expansion},
+              m_cfg.transform};
+      sfCandidatesUpdater = isg(gctx, aGenerator, rGenerator);
+    } else {
+      Acts::Experimental::detail::IndexedSurfacesGenerator<
+          decltype(internalSurfaces), Acts::Experimental::MultiLayerSurfacesImpl>
+          isg{internalSurfaces,
+              {},
+              {m_cfg.binning[0u].binValue, m_cfg.binning[1u].binValue},
+              {m_cfg.binning[0u].expansion, m_cfg.binning[1u].expansion}};
+      sfCandidatesUpdater = isg(gctx, aGenerator, rGenerator);
+    }
 
     return {internalSurfaces,
             {},
@@ -133,6 +148,8 @@ Acts::Experimental::MultiWireStructureBuilder::construct(
   MultiWireInternalStructureBuilder::Config iConfig;
   iConfig.iSurfaces = mCfg.mlSurfaces;
   iConfig.binning = mCfg.mlBinning;
+  iConfig.transform = mCfg.transform.inverse();
+  iConfig.analyticNavigation = mCfg.analyticNavigation;
   iConfig.auxiliary = "Construct Internal Structure";
 
   Acts::Experimental::DetectorVolumeBuilder::Config dvConfig;
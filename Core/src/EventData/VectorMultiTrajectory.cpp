@@ -186,6 +186,166 @@ void VectorMultiTrajectory::clear_impl() {
   }
 }
 
+auto detail_vmt::VectorMultiTrajectoryBase::appendTrackStatesFrom(
+    const VectorMultiTrajectoryBase& other, IndexType itip)
+    -> std::pair<IndexType, IndexType> {
+  if (itip == kInvalid) {
+    return {kInvalid, kInvalid};
+  }
+
+  // the sequence is only linked backward in the source, collect it from the
+  // tip inwards and append it in reverse to store it in forward order
+  std::vector<IndexType> sequence;
+  for (IndexType i = itip; i != kInvalid; i = other.m_previous[i]) {
+    sequence.push_back(i);
+  }
+
+  // resolve the dynamic columns once for the whole sequence
+  std::vector<std::pair<detail::DynamicColumnBase*,
+                        const detail::DynamicColumnBase*>>
+      dynamic;
+  dynamic.reserve(m_dynamic.size());
+  for (auto& [key, col] : m_dynamic) {
+    auto it = other.m_dynamic.find(key);
+    dynamic.emplace_back(
+        col.get(), it != other.m_dynamic.end() ? it->second.get() : nullptr);
+  }
+
+  auto copyParameters = [&](IndexType iparams) -> IndexType {
+    if (iparams == kInvalid) {
+      return kInvalid;
+    }
+    m_params.push_back(other.m_params[iparams]);
+    if (other.m_covStorage == CovarianceStorage::Full) {
+      m_cov.push_back(other.m_cov[iparams]);
+    } else {
+      other.unpackCovariance(iparams, m_cov.emplace_back());
+    }
+    return m_params.size() - 1;
+  };
+
+  IndexType stem = kInvalid;
+  IndexType previous = kInvalid;
+  for (auto it = sequence.rbegin(); it != sequence.rend(); ++it) {
+    const IndexType isrc = *it;
+    const IndexData& src = other.m_index[isrc];
+    const IndexType index = m_index.size();
+
+    // scalar components are copied as is, the column indices are rebased
+    IndexData dst = src;
+    dst.ipredicted = copyParameters(src.ipredicted);
+    dst.ifiltered = (src.ifiltered != kInvalid &&
+                     src.ifiltered == src.ipredicted)
+                        ? dst.ipredicted
+                        : copyParameters(src.ifiltered);
+    if (src.ismoothed != kInvalid && src.ismoothed == src.ipredicted) {
+      dst.ismoothed = dst.ipredicted;
+    } else if (src.ismoothed != kInvalid && src.ismoothed == src.ifiltered) {
+      dst.ismoothed = dst.ifiltered;
+    } else {
+      dst.ismoothed = copyParameters(src.ismoothed);
+    }
+
+    if (src.ijacobian != kInvalid) {
+      m_jac.push_back(other.m_jac[src.ijacobian]);
+      dst.ijacobian = m_jac.size() - 1;
+    }
+    if (src.iprojector != kInvalid) {
+      m_projectors.push_back(other.m_projectors[src.iprojector]);
+      dst.iprojector = m_projectors.size() - 1;
+    }
+
+    m_sourceLinks.push_back(other.m_sourceLinks[src.iuncalibrated]);
+    dst.iuncalibrated = m_sourceLinks.size() - 1;
+    if (src.icalibratedsourcelink != kInvalid) {
+      m_sourceLinks.push_back(other.m_sourceLinks[src.icalibratedsourcelink]);
+      dst.icalibratedsourcelink = m_sourceLinks.size() - 1;
+    }
+
+    const IndexType measOffset = other.m_measOffset[isrc];
+    if (measOffset != kInvalid) {
+      m_measOffset.push_back(static_cast<IndexType>(m_meas.size()));
+      m_meas.insert(m_meas.end(), other.m_meas.begin() + measOffset,
+                    other.m_meas.begin() + measOffset + src.measdim);
+    } else {
+      m_measOffset.push_back(kInvalid);
+    }
+    const IndexType measCovOffset = other.m_measCovOffset[isrc];
+    if (measCovOffset != kInvalid) {
+      m_measCovOffset.push_back(static_cast<IndexType>(m_measCov.size()));
+      m_measCov.insert(
+          m_measCov.end(), other.m_measCov.begin() + measCovOffset,
+          other.m_measCov.begin() + measCovOffset + src.measdim * src.measdim);
+    } else {
+      m_measCovOffset.push_back(kInvalid);
+    }
+
+    m_index.push_back(dst);
+    m_referenceSurfaces.push_back(other.m_referenceSurfaces[isrc]);
+
+    m_previous.push_back(previous);
+    m_next.push_back(kInvalid);
+    if (previous != kInvalid) {
+      m_next[previous] = index;
+    } else {
+      stem = index;
+    }
+    previous = index;
+
+    for (auto& [dstCol, srcCol] : dynamic) {
+      dstCol->add();
+      if (srcCol != nullptr) {
+        dstCol->copyFrom(index, *srcCol, isrc);
+      }
+    }
+  }
+
+  return {stem, previous};
+}
+
+void detail_vmt::VectorMultiTrajectoryBase::packCovariances(
+    CovarianceStorage storage) {
+  assert(m_covStorage == CovarianceStorage::Full);
+  if (storage == CovarianceStorage::Full) {
+    return;
+  }
+
+  auto pack = [this](auto& packed) {
+    packed.reserve(m_cov.size() * kPackedCovarianceSize);
+    for (const auto& cov : m_cov) {
+      for (std::size_t i = 0; i < eBoundSize; ++i) {
+        for (std::size_t j = i; j < eBoundSize; ++j) {
+          packed.push_back(cov(i, j));
+        }
+      }
+    }
+  };
+  if (storage == CovarianceStorage::Packed) {
+    pack(m_packedCov);
+  } else {
+    pack(m_packedCovFloat);
+  }
+
+  m_covStorage = storage;
+  decltype(m_cov)().swap(m_cov);
+}
+
+void detail_vmt::VectorMultiTrajectoryBase::unpackCovariance(
+    IndexType parIdx,
+    typename detail_lt::Types<eBoundSize>::Covariance& cov) const {
+  assert(m_covStorage != CovarianceStorage::Full);
+  std::size_t k = parIdx * kPackedCovarianceSize;
+  for (std::size_t i = 0; i < eBoundSize; ++i) {
+    for (std::size_t j = i; j < eBoundSize; ++j, ++k) {
+      double value = m_covStorage == CovarianceStorage::Packed
+                         ? m_packedCov[k]
+                         : static_cast<double>(m_packedCovFloat[k]);
+      cov(i, j) = value;
+      cov(j, i) = value;
+    }
+  }
+}
+
 void detail_vmt::VectorMultiTrajectoryBase::Statistics::toStream(
     std::ostream& os, std::size_t n) {
   using namespace boost::histogram;
@@ -224,6 +384,56 @@ void detail_vmt::VectorMultiTrajectoryBase::Statistics::toStream(
   }
 }
 
+ConstVectorMultiTrajectory::ConstVectorMultiTrajectory(
+    const ConstVectorMultiTrajectory& other)
+    : VectorMultiTrajectoryBase{other} {
+  // the copy expands its covariances again on access
+  allocateExpandedCovariances();
+}
+
+ConstVectorMultiTrajectory::ConstVectorMultiTrajectory(
+    VectorMultiTrajectory&& other, CovarianceStorage storage)
+    : VectorMultiTrajectoryBase{std::move(other)} {
+  packCovariances(storage);
+  allocateExpandedCovariances();
+}
+
+ConstVectorMultiTrajectory::~ConstVectorMultiTrajectory() {
+  if (m_expandedCov == nullptr) {
+    return;
+  }
+  for (std::size_t i = 0; i < m_params.size(); ++i) {
+    delete m_expandedCov[i].load();
+  }
+}
+
+void ConstVectorMultiTrajectory::allocateExpandedCovariances() {
+  if (m_covStorage == CovarianceStorage::Full) {
+    return;
+  }
+  m_expandedCov = std::make_unique<std::atomic<Covariance*>[]>(m_params.size());
+  for (std::size_t i = 0; i < m_params.size(); ++i) {
+    m_expandedCov[i].store(nullptr);
+  }
+}
+
+auto ConstVectorMultiTrajectory::expandedCovariance(IndexType parIdx) const
+    -> const Covariance& {
+  std::atomic<Covariance*>& slot = m_expandedCov[parIdx];
+  if (Covariance* cov = slot.load(std::memory_order_acquire); cov != nullptr) {
+    return *cov;
+  }
+  auto expanded = std::make_unique<Covariance>();
+  unpackCovariance(parIdx, *expanded);
+  // a concurrent access might have expanded the same covariance already
+  Covariance* current = nullptr;
+  if (slot.compare_exchange_strong(current, expanded.get(),
+                                   std::memory_order_acq_rel)) {
+    return *expanded.release();
+  }
+  return *current;
+}
+
 void VectorMultiTrajectory::reserve(std::size_t n) {
   m_index.reserve(n);
   m_previous.reserve(n);
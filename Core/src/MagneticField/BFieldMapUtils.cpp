@@ -180,15 +180,6 @@ Acts::fieldMapXYZ(
   yMax += stepY;
   zMax += stepZ;
 
-  // If only the first octant is given
-  if (firstOctant) {
-    xMin = -xPos[nBinsX - 1];
-    yMin = -yPos[nBinsY - 1];
-    zMin = -zPos[nBinsZ - 1];
-    nBinsX = 2 * nBinsX - 1;
-    nBinsY = 2 * nBinsY - 1;
-    nBinsZ = 2 * nBinsZ - 1;
-  }
   Acts::detail::EquidistantAxis xAxis(xMin * lengthUnit, xMax * lengthUnit,
                                       nBinsX);
   Acts::detail::EquidistantAxis yAxis(yMin * lengthUnit, yMax * lengthUnit,
@@ -209,27 +200,12 @@ Acts::fieldMapXYZ(
         Grid_t::index_t indices = {{i, j, k}};
         std::array<std::size_t, 3> nIndices = {
             {xPos.size(), yPos.size(), zPos.size()}};
-        if (firstOctant) {
-          // std::vectors begin with 0 and we do not want the user needing to
-          // take underflow or overflow bins in account this is why we need to
-          // subtract by one
-          std::size_t m = std::abs(int(i) - (int(xPos.size())));
-          std::size_t n = std::abs(int(j) - (int(yPos.size())));
-          std::size_t l = std::abs(int(k) - (int(zPos.size())));
-          Grid_t::index_t indicesFirstOctant = {{m, n, l}};
-
-          grid.atLocalBins(indices) =
-              bField.at(localToGlobalBin(indicesFirstOctant, nIndices)) *
-              BFieldUnit;
-
-        } else {
-          // std::vectors begin with 0 and we do not want the user needing to
-          // take underflow or overflow bins in account this is why we need to
-          // subtract by one
-          grid.atLocalBins(indices) =
-              bField.at(localToGlobalBin({{i - 1, j - 1, k - 1}}, nIndices)) *
-              BFieldUnit;
-        }
+        // std::vectors begin with 0 and we do not want the user needing to
+        // take underflow or overflow bins in account this is why we need to
+        // subtract by one
+        grid.atLocalBins(indices) =
+            bField.at(localToGlobalBin({{i - 1, j - 1, k - 1}}, nIndices)) *
+            BFieldUnit;
       }
     }
   }
@@ -246,8 +222,13 @@ Acts::fieldMapXYZ(
 
   // [5] Create the mapper & BField Service
   // create field mapping
-  return Acts::InterpolatedBFieldMap<Grid_t>(
-      {transformPos, transformBField, std::move(grid)});
+  Acts::InterpolatedBFieldMap<Grid_t>::Config config{
+      transformPos, transformBField, std::move(grid)};
+  // only the first octant is stored, the other ones are reflected on lookup
+  if (firstOctant) {
+    config.mirror.fill(Acts::Vector3::Ones());
+  }
+  return Acts::InterpolatedBFieldMap<Grid_t>(std::move(config));
 }
 
 Acts::InterpolatedBFieldMap<
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 #define BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
 
@@ -26,6 +27,14 @@ Acts::SolenoidBField::SolenoidBField(Config config) : m_cfg(config) {
   // at the center of the solenoid
   Vector2 field = multiCoilField({0, 0}, 1.);  // scale = 1
   m_scale = m_cfg.bMagCenter / field.norm();
+
+  if (m_cfg.tabulationTolerance > 0) {
+    if (m_cfg.tabulationRMax <= 0 || m_cfg.tabulationZMax <= 0) {
+      throw std::invalid_argument(
+          "SolenoidBField: tabulation requires a positive r and z extent");
+    }
+    tabulate();
+  }
 }
 
 Acts::MagneticFieldProvider::Cache Acts::SolenoidBField::makeCache(
@@ -36,7 +45,7 @@ Acts::MagneticFieldProvider::Cache Acts::SolenoidBField::makeCache(
 Acts::Vector3 Acts::SolenoidBField::getField(const Vector3& position) const {
   using VectorHelpers::perp;
   Vector2 rzPos(perp(position), position.z());
-  Vector2 rzField = multiCoilField(rzPos, m_scale);
+  Vector2 rzField = fieldRZ(rzPos);
   Vector3 xyzField(0, 0, rzField[1]);
 
   if (rzPos[0] != 0.) {
@@ -54,6 +63,11 @@ Acts::Result<Acts::Vector3> Acts::SolenoidBField::getField(
 }
 
 Acts::Vector2 Acts::SolenoidBField::getField(const Vector2& position) const {
+  return fieldRZ(position);
+}
+
+Acts::Vector2 Acts::SolenoidBField::getFieldExact(
+    const Vector2& position) const {
   return multiCoilField(position, m_scale);
 }
 
@@ -163,3 +177,146 @@ double Acts::SolenoidBField::k2(double r, double z) const {
   return 4 * m_cfg.radius * r /
          ((m_cfg.radius + r) * (m_cfg.radius + r) + z * z);
 }
+
+void Acts::SolenoidBField::tabulate() {
+  // an axis keeps being refined as long as more than this fraction of the
+  // cells exceeds the tolerance along it, the remaining cells are flagged
+  // for exact evaluation
+  constexpr double maxFailFraction = 0.05;
+
+  const double tol = m_cfg.tabulationTolerance;
+  const double rMax = m_cfg.tabulationRMax;
+  const double zMax = m_cfg.tabulationZMax;
+
+  auto exact = [&](double r, double z) {
+    return multiCoilField(Vector2(r, z), m_scale);
+  };
+
+  std::size_t nR = 8;
+  std::size_t nZ = 8;
+  std::vector<Vector2> nodes((nR + 1) * (nZ + 1));
+  for (std::size_t ir = 0; ir <= nR; ++ir) {
+    for (std::size_t iz = 0; iz <= nZ; ++iz) {
+      nodes[ir * (nZ + 1) + iz] = exact(ir * rMax / nR, iz * zMax / nZ);
+    }
+  }
+
+  std::vector<Vector2> fine;
+  std::vector<double> cellError;
+  while (true) {
+    // evaluate the grid refined by two along both axes, reusing the nodes
+    // which are already known
+    const std::size_t nFineR = 2 * nR;
+    const std::size_t nFineZ = 2 * nZ;
+    fine.resize((nFineR + 1) * (nFineZ + 1));
+    for (std::size_t i = 0; i <= nFineR; ++i) {
+      for (std::size_t j = 0; j <= nFineZ; ++j) {
+        fine[i * (nFineZ + 1) + j] =
+            (i % 2 == 0 && j % 2 == 0)
+                ? nodes[(i / 2) * (nZ + 1) + j / 2]
+                : exact(i * rMax / nFineR, j * zMax / nFineZ);
+      }
+    }
+    auto f = [&](std::size_t i, std::size_t j) -> const Vector2& {
+      return fine[i * (nFineZ + 1) + j];
+    };
+
+    // compare the interpolation on the current grid with the exact field at
+    // the edge and cell centers
+    std::size_t nFailR = 0;
+    std::size_t nFailZ = 0;
+    cellError.assign(nR * nZ, 0.);
+    for (std::size_t ir = 0; ir < nR; ++ir) {
+      for (std::size_t iz = 0; iz < nZ; ++iz) {
+        const std::size_t i = 2 * ir + 1;
+        const std::size_t j = 2 * iz + 1;
+        const double errR = std::max(
+            (f(i, j - 1) - 0.5 * (f(i - 1, j - 1) + f(i + 1, j - 1))).norm(),
+            (f(i, j + 1) - 0.5 * (f(i - 1, j + 1) + f(i + 1, j + 1))).norm());
+        const double errZ = std::max(
+            (f(i - 1, j) - 0.5 * (f(i - 1, j - 1) + f(i - 1, j + 1))).norm(),
+            (f(i + 1, j) - 0.5 * (f(i + 1, j - 1) + f(i + 1, j + 1))).norm());
+        const double errC = (f(i, j) - 0.25 * (f(i - 1, j - 1) +
+                                               f(i + 1, j - 1) +
+                                               f(i - 1, j + 1) +
+                                               f(i + 1, j + 1)))
+                                .norm();
+        // written such that non-finite values count as failures
+        nFailR += !(errR <= 0.5 * tol);
+        nFailZ += !(errZ <= 0.5 * tol);
+        cellError[ir * nZ + iz] = std::max({errR, errZ, errC});
+      }
+    }
+
+    const double maxFail = maxFailFraction * nR * nZ;
+    const bool refineR = nFineR <= m_cfg.tabulationMaxBins && nFailR > maxFail;
+    const bool refineZ = nFineZ <= m_cfg.tabulationMaxBins && nFailZ > maxFail;
+    if (!refineR && !refineZ) {
+      break;
+    }
+
+    if (refineR && refineZ) {
+      nodes.swap(fine);
+    } else if (refineR) {
+      nodes.resize((nFineR + 1) * (nZ + 1));
+      for (std::size_t i = 0; i <= nFineR; ++i) {
+        for (std::size_t iz = 0; iz <= nZ; ++iz) {
+          nodes[i * (nZ + 1) + iz] = f(i, 2 * iz);
+        }
+      }
+    } else {
+      nodes.resize((nR + 1) * (nFineZ + 1));
+      for (std::size_t ir = 0; ir <= nR; ++ir) {
+        for (std::size_t j = 0; j <= nFineZ; ++j) {
+          nodes[ir * (nFineZ + 1) + j] = f(2 * ir, j);
+        }
+      }
+    }
+    nR = refineR ? nFineR : nR;
+    nZ = refineZ ? nFineZ : nZ;
+  }
+
+  m_tabNR = nR;
+  m_tabNZ = nZ;
+  m_tabStepR = rMax / nR;
+  m_tabStepZ = zMax / nZ;
+  m_table = std::move(nodes);
+  m_exactCell.assign(nR * nZ, false);
+  m_tabError = 0;
+  for (std::size_t cell = 0; cell < cellError.size(); ++cell) {
+    if (!(cellError[cell] <= tol)) {
+      m_exactCell[cell] = true;
+    } else {
+      m_tabError = std::max(m_tabError, cellError[cell]);
+    }
+  }
+}
+
+Acts::Vector2 Acts::SolenoidBField::fieldRZ(const Vector2& pos) const {
+  if (m_table.empty()) {
+    return multiCoilField(pos, m_scale);
+  }
+
+  const double fr = std::abs(pos[0]) / m_tabStepR;
+  const double fz = std::abs(pos[1]) / m_tabStepZ;
+  if (!(fr < m_tabNR && fz < m_tabNZ)) {
+    return multiCoilField(pos, m_scale);
+  }
+  const auto ir = static_cast<std::size_t>(fr);
+  const auto iz = static_cast<std::size_t>(fz);
+  if (m_exactCell[ir * m_tabNZ + iz]) {
+    return multiCoilField(pos, m_scale);
+  }
+
+  const double dr = fr - ir;
+  const double dz = fz - iz;
+  const Vector2* node = &m_table[ir * (m_tabNZ + 1) + iz];
+  Vector2 field =
+      (1. - dr) * ((1. - dz) * node[0] + dz * node[1]) +
+      dr * ((1. - dz) * node[m_tabNZ + 1] + dz * node[m_tabNZ + 2]);
+  // B_r is odd under the reflection of either r or z, B_z is even
+  if ((pos[0] < 0) != (pos[1] < 0)) {
+    field[0] = -field[0];
+  }
+  return field;
+}
@@ -10,41 +10,124 @@
 
 #include "Acts/Material/MaterialSlab.hpp"
 
+#include <array>
+#include <cstring>
+#include <map>
 #include <ostream>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
+namespace {
+
+/// Interns material slabs into a palette of distinct slabs
+class MaterialSlabPalette {
+ public:
+  /// Return the palette index of the slab, adding it if it is new
+  std::uint32_t index(const Acts::MaterialSlab& slab) {
+    const Acts::Material& material = slab.material();
+    std::array<float, 6> values = {material.X0(), material.L0(),
+                                   material.Ar(), material.Z(),
+                                   material.molarDensity(), slab.thickness()};
+    // bitwise keys avoid the ordering issues of floating point comparisons
+    Key key{};
+    std::memcpy(key.data(), values.data(), sizeof(values));
+    auto [it, inserted] = m_lookup.try_emplace(
+        key, static_cast<std::uint32_t>(m_palette.size()));
+    if (inserted) {
+      m_palette.push_back(slab);
+    }
+    return it->second;
+  }
+
+  /// Release the distinct slabs in the order of their first appearance
+  Acts::MaterialSlabVector release() { return std::move(m_palette); }
+
+ private:
+  using Key = std::array<std::uint32_t, 6>;
+
+  std::map<Key, std::uint32_t> m_lookup;
+  Acts::MaterialSlabVector m_palette;
+};
+
+}  // namespace
+
 Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
     const BinUtility& binUtility, MaterialSlabVector fullProperties,
     double splitFactor, Acts::MappingType mappingType)
-    : ISurfaceMaterial(splitFactor, mappingType), m_binUtility(binUtility) {
-  // fill the material with deep copy
-  m_fullMaterial.push_back(std::move(fullProperties));
-}
+    : BinnedSurfaceMaterial(binUtility,
+                            MaterialSlabMatrix{std::move(fullProperties)},
+                            splitFactor, mappingType) {}
 
 Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
     const BinUtility& binUtility, MaterialSlabMatrix fullProperties,
     double splitFactor, Acts::MappingType mappingType)
+    : ISurfaceMaterial(splitFactor, mappingType), m_binUtility(binUtility) {
+  m_nBins0 = fullProperties.empty() ? 0 : fullProperties.front().size();
+  MaterialSlabPalette palette;
+  for (const auto& materialVector : fullProperties) {
+    if (materialVector.size() != m_nBins0) {
+      throw std::invalid_argument(
+          "Material slab matrix rows must have the same length");
+    }
+    for (const auto& materialBin : materialVector) {
+      m_indices.push_back(palette.index(materialBin));
+    }
+  }
+  m_palette = palette.release();
+}
+
+Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
+    const BinUtility& binUtility, MaterialSlabVector palette,
+    std::vector<std::uint32_t> indices, double splitFactor,
+    Acts::MappingType mappingType)
     : ISurfaceMaterial(splitFactor, mappingType),
       m_binUtility(binUtility),
-      m_fullMaterial(std::move(fullProperties)) {}
+      m_nBins0(binUtility.bins(0)),
+      m_palette(std::move(palette)),
+      m_indices(std::move(indices)) {
+  if (m_indices.size() != m_binUtility.bins()) {
+    throw std::invalid_argument(
+        "Number of palette indices does not match the binning");
+  }
+  for (std::uint32_t index : m_indices) {
+    if (index >= m_palette.size()) {
+      throw std::invalid_argument("Palette index out of range");
+    }
+  }
+}
 
 Acts::BinnedSurfaceMaterial& Acts::BinnedSurfaceMaterial::operator*=(
     double scale) {
-  for (auto& materialVector : m_fullMaterial) {
-    for (auto& materialBin : materialVector) {
-      materialBin.scaleThickness(scale);
-    }
+  // every bin refers to a palette entry, each one is scaled once
+  for (auto& materialBin : m_palette) {
+    materialBin.scaleThickness(scale);
   }
   return (*this);
 }
 
+Acts::MaterialSlabMatrix Acts::BinnedSurfaceMaterial::fullMaterial() const {
+  MaterialSlabMatrix fullMaterial;
+  if (m_nBins0 == 0) {
+    return fullMaterial;
+  }
+  for (std::size_t bin = 0; bin < m_indices.size(); bin += m_nBins0) {
+    MaterialSlabVector materialVector;
+    materialVector.reserve(m_nBins0);
+    for (std::size_t bin0 = 0; bin0 < m_nBins0; ++bin0) {
+      materialVector.push_back(m_palette[m_indices[bin + bin0]]);
+    }
+    fullMaterial.push_back(std::move(materialVector));
+  }
+  return fullMaterial;
+}
+
 const Acts::MaterialSlab& Acts::BinnedSurfaceMaterial::materialSlab(
     const Vector2& lp) const {
   // the first bin
   std::size_t ibin0 = m_binUtility.bin(lp, 0);
   std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(lp, 1) : 0;
-  return m_fullMaterial[ibin1][ibin0];
+  return materialSlab(ibin0, ibin1);
 }
 
 const Acts::MaterialSlab& Acts::BinnedSurfaceMaterial::materialSlab(
@@ -52,17 +135,19 @@ const Acts::MaterialSlab& Acts::BinnedSurfaceMaterial::materialSlab(
   // the first bin
   std::size_t ibin0 = m_binUtility.bin(gp, 0);
   std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(gp, 1) : 0;
-  return m_fullMaterial[ibin1][ibin0];
+  return materialSlab(ibin0, ibin1);
 }
 
 std::ostream& Acts::BinnedSurfaceMaterial::toStream(std::ostream& sl) const {
   sl << "Acts::BinnedSurfaceMaterial : " << std::endl;
   sl << "   - Number of Material bins [0,1] : " << m_binUtility.max(0) + 1
      << " / " << m_binUtility.max(1) + 1 << std::endl;
+  sl << "   - Number of distinct materials  : " << m_palette.size()
+     << std::endl;
   sl << "   - Parse full update material    : " << std::endl;  //
   // output  the full material
   unsigned int imat1 = 0;
-  for (auto& materialVector : m_fullMaterial) {
+  for (auto& materialVector : fullMaterial()) {
     unsigned int imat0 = 0;
     // the vector iterator
     for (auto& materialBin : materialVector) {
@@ -123,7 +123,7 @@ Acts::Vector3 Acts::ConeSurface::localToGlobal(const GeometryContext& gctx,
 Acts::Result<Acts::Vector2> Acts::ConeSurface::globalToLocal(
     const GeometryContext& gctx, const Vector3& position,
     double tolerance) const {
-  Vector3 loc3Dframe = transform(gctx).inverse() * position;
+  Vector3 loc3Dframe = inverseTransform(gctx) * position;
   double r = loc3Dframe.z() * bounds().tanAlpha();
   if (std::abs(perp(loc3Dframe) - r) > tolerance) {
     return Result<Vector2>::failure(SurfaceError::GlobalPositionNotOnSurface);
@@ -136,7 +136,7 @@ double Acts::ConeSurface::pathCorrection(const GeometryContext& gctx,
                                          const Vector3& position,
                                          const Vector3& direction) const {
   // (cos phi cos alpha, sin phi cos alpha, sgn z sin alpha)
-  Vector3 posLocal = transform(gctx).inverse() * position;
+  Vector3 posLocal = inverseTransform(gctx) * position;
   double phi = VectorHelpers::phi(posLocal);
   double sgn = posLocal.z() > 0. ? -1. : +1.;
   double cosAlpha = std::cos(bounds().get(ConeBounds::eAlpha));
@@ -168,7 +168,7 @@ Acts::Vector3 Acts::ConeSurface::normal(const GeometryContext& gctx,
                                         const Acts::Vector3& position) const {
   // get it into the cylinder frame if needed
   // @todo respect opening angle
-  Vector3 pos3D = transform(gctx).inverse() * position;
+  Vector3 pos3D = inverseTransform(gctx) * position;
   pos3D.z() = 0;
   return pos3D.normalized();
 }
@@ -269,7 +269,7 @@ Acts::detail::RealQuadraticEquation Acts::ConeSurface::intersectionSolver(
     const GeometryContext& gctx, const Vector3& position,
     const Vector3& direction) const {
   // Transform into the local frame
-  Transform3 invTrans = transform(gctx).inverse();
+  Transform3 invTrans = inverseTransform(gctx);
   Vector3 point1 = invTrans * position;
   Vector3 dir1 = invTrans.linear() * direction;
 
@@ -387,10 +387,8 @@ Acts::ActsMatrix<2, 3> Acts::ConeSurface::localCartesianToBoundLocalDerivative(
     const GeometryContext& gctx, const Vector3& position) const {
   using VectorHelpers::perp;
   using VectorHelpers::phi;
-  // The local frame transform
-  const auto& sTransform = transform(gctx);
   // calculate the transformation to local coordinates
-  const Vector3 localPos = sTransform.inverse() * position;
+  const Vector3 localPos = inverseTransform(gctx) * position;
   const double lr = perp(localPos);
   const double lphi = phi(localPos);
   const double lcphi = std::cos(lphi);
@@ -129,9 +129,7 @@ Acts::Result<Acts::Vector2> Acts::CylinderSurface::globalToLocal(
   if (inttol < 0.01) {
     inttol = 0.01;
   }
-  const Transform3& sfTransform = transform(gctx);
-  Transform3 inverseTrans(sfTransform.inverse());
-  Vector3 loc3Dframe(inverseTrans * position);
+  Vector3 loc3Dframe(inverseTransform(gctx) * position);
   if (std::abs(perp(loc3Dframe) - bounds().get(CylinderBounds::eR)) > inttol) {
     return Result<Vector2>::failure(SurfaceError::GlobalPositionNotOnSurface);
   }
@@ -154,7 +152,7 @@ Acts::Vector3 Acts::CylinderSurface::normal(
     const GeometryContext& gctx, const Acts::Vector3& position) const {
   const Transform3& sfTransform = transform(gctx);
   // get it into the cylinder frame
-  Vector3 pos3D = sfTransform.inverse() * position;
+  Vector3 pos3D = inverseTransform(gctx) * position;
   // set the z coordinate to 0
   pos3D.z() = 0.;
   // normalize and rotate back into global
@@ -339,10 +337,8 @@ Acts::CylinderSurface::localCartesianToBoundLocalDerivative(
     const GeometryContext& gctx, const Vector3& position) const {
   using VectorHelpers::perp;
   using VectorHelpers::phi;
-  // The local frame transform
-  const auto& sTransform = transform(gctx);
   // calculate the transformation to local coordinates
-  const Vector3 localPos = sTransform.inverse() * position;
+  const Vector3 localPos = inverseTransform(gctx) * position;
   const double lr = perp(localPos);
   const double lphi = phi(localPos);
   const double lcphi = std::cos(lphi);
@@ -83,7 +83,7 @@ Acts::Result<Acts::Vector2> Acts::LineSurface::globalToLocal(
 
   // Bring the global position into the local frame. First remove the
   // translation then the rotation.
-  Vector3 localPosition = referenceFrame(gctx, position, direction).inverse() *
+  Vector3 localPosition = referenceFrame(gctx, position, direction).transpose() *
                           (position - transform(gctx).translation());
 
   // `localPosition.z()` is not the distance to the PCA but the smallest
@@ -312,7 +312,7 @@ Acts::AlignmentToPathMatrix Acts::LineSurface::alignmentToPathDerivative(
 Acts::ActsMatrix<2, 3> Acts::LineSurface::localCartesianToBoundLocalDerivative(
     const GeometryContext& gctx, const Vector3& position) const {
   // calculate the transformation to local coordinates
-  Vector3 localPosition = transform(gctx).inverse() * position;
+  Vector3 localPosition = inverseTransform(gctx) * position;
   double localPhi = VectorHelpers::phi(localPosition);
 
   ActsMatrix<2, 3> loc3DToLocBound = ActsMatrix<2, 3>::Zero();
@@ -54,6 +54,7 @@ Acts::PlaneSurface::PlaneSurface(const Vector3& center, const Vector3& normal)
   // curvilinear surfaces are boundless
   m_transform = Transform3{curvilinearRotation};
   m_transform.pretranslate(center);
+  m_inverseTransform = m_transform.inverse(Eigen::Isometry);
 }
 
 Acts::PlaneSurface::PlaneSurface(std::shared_ptr<const PlanarBounds> pbounds,
@@ -88,7 +89,7 @@ Acts::Vector3 Acts::PlaneSurface::localToGlobal(
 Acts::Result<Acts::Vector2> Acts::PlaneSurface::globalToLocal(
     const GeometryContext& gctx, const Vector3& position,
     double tolerance) const {
-  Vector3 loc3Dframe = transform(gctx).inverse() * position;
+  Vector3 loc3Dframe = inverseTransform(gctx) * position;
   if (std::abs(loc3Dframe.z()) > std::abs(tolerance)) {
     return Result<Vector2>::failure(SurfaceError::GlobalPositionNotOnSurface);
   }
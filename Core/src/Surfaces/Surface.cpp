@@ -23,7 +23,9 @@ std::array<std::string, Acts::Surface::SurfaceType::Other>
         "Cone", "Cylinder", "Disc", "Perigee", "Plane", "Straw", "Curvilinear"};
 
 Acts::Surface::Surface(const Transform3& transform)
-    : GeometryObject(), m_transform(transform) {}
+    : GeometryObject(),
+      m_transform(transform),
+      m_inverseTransform(transform.inverse(Eigen::Isometry)) {}
 
 Acts::Surface::Surface(const DetectorElementBase& detelement)
     : GeometryObject(), m_associatedDetElement(&detelement) {}
@@ -32,12 +34,14 @@ Acts::Surface::Surface(const Surface& other)
     : GeometryObject(other),
       std::enable_shared_from_this<Surface>(),
       m_transform(other.m_transform),
+      m_inverseTransform(other.m_inverseTransform),
       m_surfaceMaterial(other.m_surfaceMaterial) {}
 
 Acts::Surface::Surface(const GeometryContext& gctx, const Surface& other,
                        const Transform3& shift)
     : GeometryObject(),
       m_transform(shift * other.transform(gctx)),
+      m_inverseTransform(m_transform.inverse(Eigen::Isometry)),
       m_surfaceMaterial(other.m_surfaceMaterial) {}
 
 Acts::Surface::~Surface() = default;
@@ -154,6 +158,7 @@ Acts::Surface& Acts::Surface::operator=(const Surface& other) {
     GeometryObject::operator=(other);
     // detector element, identifier & layer association are unique
     m_transform = other.m_transform;
+    m_inverseTransform = other.m_inverseTransform;
     m_associatedLayer = other.m_associatedLayer;
     m_surfaceMaterial = other.m_surfaceMaterial;
     m_associatedDetElement = other.m_associatedDetElement;
@@ -240,6 +245,14 @@ const Acts::Transform3& Acts::Surface::transform(
   return m_transform;
 }
 
+Acts::Transform3 Acts::Surface::inverseTransform(
+    const GeometryContext& gctx) const {
+  if (m_associatedDetElement != nullptr) {
+    return m_associatedDetElement->inverseTransform(gctx);
+  }
+  return m_inverseTransform;
+}
+
 bool Acts::Surface::insideBounds(const Vector2& lposition,
                                  const BoundaryCheck& bcheck) const {
   return bounds().inside(lposition, bcheck);
@@ -351,6 +364,7 @@ void Acts::Surface::assignDetectorElement(
   // resetting the transform as it will be handled through the detector element
   // now
   m_transform = Transform3::Identity();
+  m_inverseTransform = Transform3::Identity();
 }
 
 void Acts::Surface::assignSurfaceMaterial(
@@ -9,11 +9,18 @@
 // TODO: update to C++17 style
 #include "Acts/TrackFinding/RoiDescriptor.hpp"
 
+#include "Acts/Utilities/BinningType.hpp"
+
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <sstream>
 
 namespace Acts {
 
+std::atomic<double> Acts::RoiDescriptor::s_zedWidthDefault = 225;
+std::atomic<bool> Acts::RoiDescriptor::s_firstInstanceCreated = false;
+
 Acts::RoiDescriptor::RoiDescriptor(double eta, double etaMinus, double etaPlus,
                                    double phi, double phiMinus, double phiPlus,
                                    double zed, double zedMinus, double zedPlus)
@@ -36,8 +43,138 @@ Acts::RoiDescriptor::RoiDescriptor(double eta, double etaMinus, double etaPlus,
 
   m_dzdrMinus = 1 / m_drdzMinus;  //-45
   m_dzdrPlus = 1 / m_drdzPlus;    // 45
+
+  m_zedOuterMinus = m_zedMinus + s_rOuter * m_dzdrMinus;
+  m_zedOuterPlus = m_zedPlus + s_rOuter * m_dzdrPlus;
+
+  s_firstInstanceCreated = true;
 }
 
+Acts::RoiDescriptor::RoiDescriptor(bool fullscan)
+    : RoiDescriptor(0, -5, 5, 0, -M_PI, M_PI) {
+  m_fullscan = fullscan;
+}
+
+Acts::RoiDescriptor::RoiDescriptor(const RoiDescriptor& roi) = default;
+
+Acts::RoiDescriptor& Acts::RoiDescriptor::operator=(const RoiDescriptor& r) =
+    default;
+
 Acts::RoiDescriptor::~RoiDescriptor() = default;
 
+void Acts::RoiDescriptor::zedWidthDefault(double d) {
+  if (!s_firstInstanceCreated) {
+    s_zedWidthDefault = d;
+  }
+}
+
+double Acts::RoiDescriptor::zedMin(double r) const {
+  return m_zedMinus + r * m_dzdrMinus;
+}
+
+double Acts::RoiDescriptor::zedMax(double r) const {
+  return m_zedPlus + r * m_dzdrPlus;
+}
+
+double Acts::RoiDescriptor::rhoMin(double z) const {
+  // the rear boundary limits r from below for backward pointing RoI edges and
+  // the front boundary for forward pointing ones
+  double rho = 0;
+  if (m_dzdrMinus < 0) {
+    rho = std::max(rho, (z - m_zedMinus) * m_drdzMinus);
+  }
+  if (m_dzdrPlus > 0) {
+    rho = std::max(rho, (z - m_zedPlus) * m_drdzPlus);
+  }
+  return rho;
+}
+
+double Acts::RoiDescriptor::rhoMax(double z) const {
+  double rho = std::numeric_limits<double>::max();
+  if (m_dzdrMinus > 0) {
+    rho = std::min(rho, (z - m_zedMinus) * m_drdzMinus);
+  }
+  if (m_dzdrPlus < 0) {
+    rho = std::min(rho, (z - m_zedPlus) * m_drdzPlus);
+  }
+  return rho;
+}
+
+bool Acts::RoiDescriptor::containsPhi(double phi) const {
+  if (m_fullscan) {
+    return true;
+  }
+  if (m_composite) {
+    return std::any_of(begin(), end(), [&](const RoiDescriptor* roi) {
+      return roi->containsPhi(phi);
+    });
+  }
+  if (m_phiPlus >= m_phiMinus) {
+    return m_phiMinus <= phi && phi <= m_phiPlus;
+  }
+  // the RoI wraps around at +-pi
+  return m_phiMinus <= phi || phi <= m_phiPlus;
+}
+
+bool Acts::RoiDescriptor::containsZed(double z, double r) const {
+  if (m_fullscan) {
+    return true;
+  }
+  if (m_composite) {
+    return std::any_of(begin(), end(), [&](const RoiDescriptor* roi) {
+      return roi->containsZed(z, r);
+    });
+  }
+  return zedMin(r) <= z && z <= zedMax(r);
+}
+
+bool Acts::RoiDescriptor::contains(double z, double r, double phi) const {
+  if (m_fullscan) {
+    return true;
+  }
+  if (m_composite) {
+    return std::any_of(begin(), end(), [&](const RoiDescriptor* roi) {
+      return roi->contains(z, r, phi);
+    });
+  }
+  return containsPhi(phi) && containsZed(z, r);
+}
+
+bool Acts::RoiDescriptor::overlaps(const Extent& extent) const {
+  if (m_fullscan) {
+    return true;
+  }
+  if (m_composite) {
+    return std::any_of(begin(), end(), [&](const RoiDescriptor* roi) {
+      return roi->overlaps(extent);
+    });
+  }
+
+  if (extent.constrains(binPhi)) {
+    const double phiMin = extent.min(binPhi);
+    const double phiMax = extent.max(binPhi);
+    const bool phiOverlap =
+        (m_phiPlus >= m_phiMinus)
+            ? (phiMin <= m_phiPlus && m_phiMinus <= phiMax)
+            : (phiMin <= m_phiPlus || m_phiMinus <= phiMax);
+    if (!phiOverlap) {
+      return false;
+    }
+  }
+
+  if (extent.constrains(binZ) && extent.constrains(binR)) {
+    // the z boundaries are linear in r, so it is enough to compare the
+    // extremes at the radial borders of the extent
+    const double rMin = extent.min(binR);
+    const double rMax = extent.max(binR);
+    const double zLow = std::min(zedMin(rMin), zedMin(rMax));
+    const double zHigh = std::max(zedMax(rMin), zedMax(rMax));
+    if (extent.max(binZ) < zLow || zHigh < extent.min(binZ)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace Acts
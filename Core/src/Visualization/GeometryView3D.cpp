@@ -26,16 +26,22 @@
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Surfaces/SurfaceBounds.hpp"
 #include "Acts/Utilities/BinnedArray.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/IAxis.hpp"
 #include "Acts/Utilities/UnitVectors.hpp"
 #include "Acts/Visualization/IVisualization3D.hpp"
+#include "Acts/Visualization/ObjVisualization3D.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <map>
 #include <memory>
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -62,8 +68,115 @@ std::string getWorkingDirectory() {
                                                     : std::string(""));
 }
 
+/// Number of surfaces after which the buffered object data is written out
+constexpr std::size_t s_flushSurfaces = 1000;
+
+/// Writes the surfaces of an array to a single output in chunks.
+///
+/// The object format is written in chunks of a fixed number of surfaces,
+/// such that the memory of the helper stays bounded for large arrays, all
+/// other helpers are written at once.
+class ChunkedWriter {
+ public:
+  ChunkedWriter(Acts::IVisualization3D& helper, const std::string& path)
+      : m_helper(helper), m_path(path) {
+    if (path.empty()) {
+      return;
+    }
+    m_objDouble = dynamic_cast<Acts::ObjVisualization3D<double>*>(&helper);
+    m_objFloat = dynamic_cast<Acts::ObjVisualization3D<float>*>(&helper);
+    if (m_objDouble != nullptr) {
+      m_objDouble->open(path, m_os, m_mos);
+    } else if (m_objFloat != nullptr) {
+      m_objFloat->open(path, m_os, m_mos);
+    }
+  }
+
+  /// Register a drawn surface and flush if the chunk is complete
+  void surfaceDrawn() {
+    if (++m_nSurfaces % s_flushSurfaces == 0) {
+      flush();
+    }
+  }
+
+  /// Write the remaining content and clear the helper
+  void finish() {
+    if (m_path.empty()) {
+      return;
+    }
+    if (m_os.is_open()) {
+      flush();
+      m_os.close();
+      m_mos.close();
+    } else {
+      m_helper.write(m_path);
+    }
+    m_helper.clear();
+  }
+
+ private:
+  void flush() {
+    if (m_objDouble != nullptr) {
+      m_objDouble->flush(m_os, m_mos);
+    } else if (m_objFloat != nullptr) {
+      m_objFloat->flush(m_os, m_mos);
+    }
+  }
+
+  Acts::IVisualization3D& m_helper;
+  std::string m_path;
+  Acts::ObjVisualization3D<double>* m_objDouble = nullptr;
+  Acts::ObjVisualization3D<float>* m_objFloat = nullptr;
+  std::ofstream m_os;
+  std::ofstream m_mos;
+  std::size_t m_nSurfaces = 0;
+};
+
+void drawCachedSurface(Acts::GeometryView3D::TessellationCache& cache,
+                       Acts::IVisualization3D& helper,
+                       const Acts::Surface& surface,
+                       const Acts::GeometryContext& gctx,
+                       const Acts::Transform3& transform,
+                       const Acts::ViewConfig& viewConfig) {
+  if (!viewConfig.visible) {
+    return;
+  }
+  Acts::Polyhedron surfaceHedron =
+      cache.polyhedron(surface, gctx, viewConfig.nSegments);
+  if (!transform.isApprox(Acts::Transform3::Identity())) {
+    surfaceHedron.move(transform);
+  }
+  Acts::GeometryView3D::drawPolyhedron(helper, surfaceHedron, viewConfig);
+}
+
 }  // namespace
 
+Acts::Polyhedron Acts::GeometryView3D::TessellationCache::polyhedron(
+    const Surface& surface, const GeometryContext& gctx,
+    std::size_t nSegments) {
+  if (surface.type() != Surface::Plane && surface.type() != Surface::Disc) {
+    return surface.polyhedronRepresentation(gctx, nSegments);
+  }
+  const auto& bounds = surface.bounds();
+  std::vector<double> key = bounds.values();
+  key.push_back(static_cast<double>(surface.type()));
+  key.push_back(static_cast<double>(bounds.type()));
+  key.push_back(static_cast<double>(nSegments));
+
+  const Transform3& transform = surface.transform(gctx);
+  auto it = m_local.find(key);
+  if (it == m_local.end()) {
+    Polyhedron global = surface.polyhedronRepresentation(gctx, nSegments);
+    Polyhedron local = global;
+    local.move(transform.inverse());
+    m_local.emplace(std::move(key), std::move(local));
+    return global;
+  }
+  Polyhedron global = it->second;
+  global.move(transform);
+  return global;
+}
+
 namespace Acts {
 namespace Experimental {
 ViewConfig s_viewSensitive = ViewConfig({0, 180, 240});
@@ -104,24 +217,28 @@ void Acts::GeometryView3D::drawSurfaceArray(
     IVisualization3D& helper, const SurfaceArray& surfaceArray,
     const GeometryContext& gctx, const Transform3& transform,
     const ViewConfig& sensitiveConfig, const ViewConfig& passiveConfig,
-    const ViewConfig& gridConfig, const std::string& _outputDir) {
+    const ViewConfig& gridConfig, const std::string& _outputDir,
+    TessellationCache* cache) {
   std::string outputDir =
       _outputDir == "." ? getWorkingDirectory() : _outputDir;
+  TessellationCache localCache;
+  TessellationCache& tessellation = cache != nullptr ? *cache : localCache;
   // Draw all the surfaces
   Extent arrayExtent;
+  ChunkedWriter writer(helper,
+                       sensitiveConfig.outputName.empty()
+                           ? std::string()
+                           : joinPaths(outputDir, sensitiveConfig.outputName));
   for (const auto& sf : surfaceArray.surfaces()) {
     ViewConfig vConfig = sf->associatedDetectorElement() != nullptr
                              ? sensitiveConfig
                              : passiveConfig;
-    drawSurface(helper, *sf, gctx, transform, vConfig);
-    auto sfExtent = sf->polyhedronRepresentation(gctx, 1).extent();
+    drawCachedSurface(tessellation, helper, *sf, gctx, transform, vConfig);
+    auto sfExtent = tessellation.polyhedron(*sf, gctx, 1).extent();
     arrayExtent.extend(sfExtent);
+    writer.surfaceDrawn();
   }
-
-  if (!sensitiveConfig.outputName.empty()) {
-    helper.write(joinPaths(outputDir, sensitiveConfig.outputName));
-    helper.clear();
-  }
+  writer.finish();
 
   double thickness = gridConfig.lineThickness;
   // Draw the grid itself
@@ -219,10 +336,13 @@ void Acts::GeometryView3D::drawDetectorVolume(
     IVisualization3D& helper, const Experimental::DetectorVolume& volume,
     const GeometryContext& gctx, const Transform3& transform,
     const ViewConfig& connected, const ViewConfig& unconnected,
-    const ViewConfig& viewConfig) {
+    const ViewConfig& viewConfig, TessellationCache* cache) {
+  TessellationCache localCache;
+  TessellationCache& tessellation = cache != nullptr ? *cache : localCache;
   // draw the surfaces of the mother volume
   for (auto surface : volume.surfaces()) {
-    drawSurface(helper, *surface, gctx, transform, viewConfig);
+    drawCachedSurface(tessellation, helper, *surface, gctx, transform,
+                      viewConfig);
   }
 
   // draw the envelope first
@@ -233,14 +353,15 @@ void Acts::GeometryView3D::drawDetectorVolume(
   // recurse if there are subvolumes
   for (auto subvolume : volume.volumes()) {
     drawDetectorVolume(helper, *subvolume, gctx, transform, connected,
-                       unconnected, viewConfig);
+                       unconnected, viewConfig, &tessellation);
   }
 }
 
 void Acts::GeometryView3D::drawLayer(
     IVisualization3D& helper, const Layer& layer, const GeometryContext& gctx,
     const ViewConfig& layerConfig, const ViewConfig& sensitiveConfig,
-    const ViewConfig& gridConfig, const std::string& _outputDir) {
+    const ViewConfig& gridConfig, const std::string& _outputDir,
+    TessellationCache* cache) {
   std::string outputDir =
       _outputDir == "." ? getWorkingDirectory() : _outputDir;
 
@@ -264,7 +385,8 @@ void Acts::GeometryView3D::drawLayer(
     auto surfaceArray = layer.surfaceArray();
     if (surfaceArray != nullptr) {
       drawSurfaceArray(helper, *surfaceArray, gctx, Transform3::Identity(),
-                       sensitiveConfig, layerConfig, gridConfig, outputDir);
+                       sensitiveConfig, layerConfig, gridConfig, outputDir,
+                       cache);
     }
   }
 }
@@ -274,15 +396,18 @@ void Acts::GeometryView3D::drawTrackingVolume(
     const GeometryContext& gctx, const ViewConfig& containerView,
     const ViewConfig& volumeView, const ViewConfig& layerView,
     const ViewConfig& sensitiveView, const ViewConfig& gridView, bool writeIt,
-    const std::string& tag, const std::string& _outputDir) {
+    const std::string& tag, const std::string& _outputDir,
+    TessellationCache* cache) {
   std::string outputDir =
       _outputDir == "." ? getWorkingDirectory() : _outputDir;
+  TessellationCache localCache;
+  TessellationCache& tessellation = cache != nullptr ? *cache : localCache;
   if (tVolume.confinedVolumes() != nullptr) {
     const auto& subVolumes = tVolume.confinedVolumes()->arrayObjects();
     for (const auto& tv : subVolumes) {
       drawTrackingVolume(helper, *tv, gctx, containerView, volumeView,
                          layerView, sensitiveView, gridView, writeIt, tag,
-                         outputDir);
+                         outputDir, &tessellation);
     }
   }
 
@@ -347,7 +472,8 @@ void Acts::GeometryView3D::drawTrackingVolume(
         gConfig.outputName =
             vname + std::string("_grids_l") + std::to_string(il) + tag;
       }
-      drawLayer(helper, *tl, gctx, lConfig, sConfig, gConfig, outputDir);
+      drawLayer(helper, *tl, gctx, lConfig, sConfig, gConfig, outputDir,
+                &tessellation);
       ++il;
     }
   }
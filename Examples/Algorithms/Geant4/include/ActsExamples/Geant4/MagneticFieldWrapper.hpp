@@ -10,6 +10,7 @@
 
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstddef>
 #include <memory>
 
 #include <G4MagneticField.hh>
@@ -56,6 +57,9 @@ class MagneticFieldWrapper : public G4MagneticField {
 
   /// The looging instance
   std::unique_ptr<const Acts::Logger> m_logger;
+
+  /// Unique identifier of this wrapper for the per-thread field caches
+  std::size_t m_cacheId = 0;
 };
 
 }  // namespace ActsExamples
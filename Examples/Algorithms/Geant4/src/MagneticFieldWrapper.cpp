@@ -14,6 +14,8 @@
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <atomic>
+#include <optional>
 #include <ostream>
 #include <system_error>
 #include <utility>
@@ -23,19 +25,32 @@
 
 ActsExamples::MagneticFieldWrapper::MagneticFieldWrapper(
     const Config& cfg, std::unique_ptr<const Acts::Logger> logger)
-    : G4MagneticField(), m_cfg(cfg), m_logger(std::move(logger)) {}
+    : G4MagneticField(), m_cfg(cfg), m_logger(std::move(logger)) {
+  static std::atomic<std::size_t> nextCacheId{1};
+  m_cacheId = nextCacheId++;
+}
 
 void ActsExamples::MagneticFieldWrapper::GetFieldValue(const G4double Point[4],
                                                        G4double* Bfield) const {
   constexpr double convertLength = CLHEP::mm / Acts::UnitConstants::mm;
   constexpr double convertField = CLHEP::tesla / Acts::UnitConstants::T;
 
-  auto bCache = m_cfg.magneticField->makeCache(Acts::MagneticFieldContext());
+  // Geant4 queries the field concurrently from its worker threads. Each
+  // thread keeps its cache, e.g. the current cell of a field map, between the
+  // queries. It is only recreated if the thread switches to another wrapper.
+  thread_local std::size_t cacheId = 0;
+  thread_local std::optional<Acts::MagneticFieldProvider::Cache> bCache;
+  if (cacheId != m_cacheId) {
+    bCache.reset();
+    bCache.emplace(
+        m_cfg.magneticField->makeCache(Acts::MagneticFieldContext()));
+    cacheId = m_cacheId;
+  }
 
   auto fieldRes = m_cfg.magneticField->getField(
       {convertLength * Point[0], convertLength * Point[1],
        convertLength * Point[2]},
-      bCache);
+      *bCache);
   if (!fieldRes.ok()) {
     ACTS_ERROR("Field lookup error: " << fieldRes.error());
     return;
@@ -0,0 +1,38 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+
+#include <unordered_set>
+
+namespace Acts {
+class RoiDescriptor;
+class TrackingGeometry;
+}  // namespace Acts
+
+namespace ActsExamples {
+
+/// Collect the sensitive surfaces that can contain hits inside a region of
+/// interest.
+///
+/// The selection is based on the extent of the surface polyhedron
+/// representation and is therefore conservative, i.e. surfaces that only
+/// touch the RoI boundaries are selected as well.
+///
+/// @param trackingGeometry is the geometry to select the surfaces from
+/// @param geoContext is the geometry context used to place the surfaces
+/// @param roi is the region of interest
+/// @return identifiers of all sensitive surfaces overlapping the RoI
+std::unordered_set<Acts::GeometryIdentifier> selectRoiSurfaces(
+    const Acts::TrackingGeometry& trackingGeometry,
+    const Acts::GeometryContext& geoContext, const Acts::RoiDescriptor& roi);
+
+}  // namespace ActsExamples
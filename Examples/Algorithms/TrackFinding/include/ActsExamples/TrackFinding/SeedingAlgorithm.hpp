@@ -13,6 +13,7 @@
 #include "Acts/Seeding/SeedFinder.hpp"
 #include "Acts/Seeding/SeedFinderConfig.hpp"
 #include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/TrackFinding/RoiDescriptor.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/EventData/SimSeed.hpp"
@@ -58,6 +59,10 @@ class SeedingAlgorithm final : public IAlgorithm {
     // allow for different values of rMax in gridConfig and seedFinderConfig
     bool allowSeparateRMax = false;
 
+    // optional region of interest, only space points inside of it are used
+    // for seeding
+    std::shared_ptr<const Acts::RoiDescriptor> roi;
+
     // vector containing the map of z bins in the top and bottom layers
     std::vector<std::pair<int, int>> zBinNeighborsTop;
     std::vector<std::pair<int, int>> zBinNeighborsBottom;
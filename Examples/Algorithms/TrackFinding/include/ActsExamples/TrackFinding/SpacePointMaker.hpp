@@ -10,6 +10,7 @@
 
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/SpacePointFormation/SpacePointBuilder.hpp"
+#include "Acts/TrackFinding/RoiDescriptor.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
@@ -19,7 +20,9 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace Acts {
@@ -62,6 +65,9 @@ class SpacePointMaker final : public IAlgorithm {
     /// with all components set to zero selects all available measurements. The
     /// selection must not have duplicates.
     std::vector<Acts::GeometryIdentifier> geometrySelection;
+    /// Optional region of interest. If set, only measurements on surfaces
+    /// overlapping the RoI are converted into space points.
+    std::shared_ptr<const Acts::RoiDescriptor> roi;
   };
 
   /// Construct the space point maker.
@@ -84,6 +90,8 @@ class SpacePointMaker final : public IAlgorithm {
 
   std::optional<IndexSourceLink::SurfaceAccessor> m_slSurfaceAccessor;
 
+  std::optional<std::unordered_set<Acts::GeometryIdentifier>> m_roiSurfaces;
+
   Acts::SpacePointBuilder<SimSpacePoint> m_spacePointBuilder;
 
   ReadDataHandle<IndexSourceLinkContainer> m_inputSourceLinks{
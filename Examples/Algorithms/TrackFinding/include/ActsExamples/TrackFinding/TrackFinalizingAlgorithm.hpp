@@ -0,0 +1,99 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/TrackFinding/TrackFinalization.hpp"
+#include "Acts/TrackFinding/TrackSelector.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace Acts {
+class MagneticFieldProvider;
+class TrackingGeometry;
+}  // namespace Acts
+
+namespace ActsExamples {
+struct AlgorithmContext;
+
+/// Smooth tracks and extrapolate them to a reference surface.
+///
+/// This is the deferred part of the track finding if the
+/// `TrackFindingAlgorithm` runs without smoothing. Running it after the
+/// ambiguity resolution avoids smoothing and extrapolating the duplicates.
+/// Tracks failing the smoothing or the extrapolation are dropped.
+class TrackFinalizingAlgorithm final : public IAlgorithm {
+ public:
+  using Propagator = Acts::Propagator<Acts::EigenStepper<>, Acts::Navigator>;
+
+  struct Config {
+    /// Input filtered tracks collection.
+    std::string inputTracks;
+    /// Output smoothed and extrapolated tracks collection.
+    std::string outputTracks;
+
+    /// Tracking geometry for the extrapolation.
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry;
+    /// Magnetic field for the extrapolation.
+    std::shared_ptr<const Acts::MagneticFieldProvider> magneticField;
+
+    /// Reference surface of the tracks, a perigee at the origin if not set.
+    std::shared_ptr<const Acts::Surface> referenceSurface;
+    /// Track state the extrapolation starts from.
+    Acts::TrackExtrapolationStrategy extrapolationStrategy =
+        Acts::TrackExtrapolationStrategy::first;
+    /// Maximum number of propagation steps of the extrapolation
+    unsigned int maxSteps = 100000;
+    /// Track selector config, applied to the extrapolated tracks
+    std::optional<Acts::TrackSelector::Config> trackSelectorCfg = std::nullopt;
+  };
+
+  /// Construct the track finalizing algorithm.
+  ///
+  /// @param config is the algorithm configuration
+  /// @param level is the logging level
+  TrackFinalizingAlgorithm(Config config, Acts::Logging::Level level);
+
+  /// Smooth and extrapolate the tracks of one event.
+  ///
+  /// @param ctx is the algorithm context with event information
+  /// @return a process code indication success or failure
+  ProcessCode execute(const AlgorithmContext& ctx) const final;
+
+  /// Const access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  ProcessCode finalize() override;
+
+  Config m_cfg;
+  std::shared_ptr<const Acts::Surface> m_referenceSurface;
+  std::shared_ptr<const Propagator> m_propagator;
+  std::optional<Acts::TrackSelector> m_trackSelector;
+
+  ReadDataHandle<ConstTrackContainer> m_inputTracks{this, "InputTracks"};
+  WriteDataHandle<ConstTrackContainer> m_outputTracks{this, "OutputTracks"};
+
+  mutable std::atomic<std::size_t> m_nTotalTracks{0};
+  mutable std::atomic<std::size_t> m_nFailedTracks{0};
+};
+
+}  // namespace ActsExamples
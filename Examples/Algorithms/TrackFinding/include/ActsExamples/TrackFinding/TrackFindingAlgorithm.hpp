@@ -17,6 +17,7 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
 #include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/RoiDescriptor.hpp"
 #include "Acts/TrackFinding/SourceLinkAccessorConcept.hpp"
 #include "Acts/TrackFinding/TrackSelector.hpp"
 #include "Acts/Utilities/Logger.hpp"
@@ -35,6 +36,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <tbb/combinable.h>
@@ -97,8 +99,24 @@ class TrackFindingAlgorithm final : public IAlgorithm {
     std::optional<Acts::TrackSelector::Config> trackSelectorCfg = std::nullopt;
     /// Run backward finding
     bool backward = false;
+    /// Smooth the found tracks and extrapolate them to the perigee. If
+    /// disabled, the tracks are only filtered and can be finalized later on
+    /// with the `TrackFinalizingAlgorithm`, e.g. after ambiguity resolution.
+    bool smoothing = true;
+    /// Storage of the track state covariances of the found tracks. The packed
+    /// storage keeps the same content in less memory, see
+    /// `Acts::ConstVectorMultiTrajectory`.
+    Acts::ConstVectorMultiTrajectory::CovarianceStorage
+        trackStateCovarianceStorage =
+            Acts::ConstVectorMultiTrajectory::CovarianceStorage::Full;
     /// Maximum number of propagation steps
     unsigned int maxSteps = 100000;
+    /// Optional region of interest. If set, only measurements on surfaces
+    /// overlapping the RoI are visible to the track finding.
+    std::shared_ptr<const Acts::RoiDescriptor> roi;
+    /// Tracking geometry used to select the RoI surfaces. Only required if a
+    /// RoI is set.
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry;
   };
 
   /// Constructor of the track finding algorithm
@@ -127,6 +145,7 @@ class TrackFindingAlgorithm final : public IAlgorithm {
  private:
   Config m_cfg;
   std::optional<Acts::TrackSelector> m_trackSelector;
+  std::optional<std::unordered_set<Acts::GeometryIdentifier>> m_roiSurfaces;
 
   ReadDataHandle<MeasurementContainer> m_inputMeasurements{this,
                                                            "InputMeasurements"};
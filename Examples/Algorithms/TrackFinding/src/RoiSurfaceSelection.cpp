@@ -0,0 +1,29 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/TrackFinding/RoiSurfaceSelection.hpp"
+
+#include "Acts/Geometry/Polyhedron.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/TrackFinding/RoiDescriptor.hpp"
+
+std::unordered_set<Acts::GeometryIdentifier> ActsExamples::selectRoiSurfaces(
+    const Acts::TrackingGeometry& trackingGeometry,
+    const Acts::GeometryContext& geoContext, const Acts::RoiDescriptor& roi) {
+  std::unordered_set<Acts::GeometryIdentifier> selection;
+  trackingGeometry.visitSurfaces([&](const Acts::Surface* surface) {
+    // a single segment per quarter circle is enough as the extent is only
+    // used for a conservative overlap check
+    auto extent = surface->polyhedronRepresentation(geoContext, 1).extent();
+    if (roi.overlaps(extent)) {
+      selection.insert(surface->geometryId());
+    }
+  });
+  return selection;
+}
@@ -50,6 +50,9 @@ ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
           m_cfg.seedFinderConfig);
   m_cfg.gridConfig = m_cfg.gridConfig.toInternalUnits();
   m_cfg.gridOptions = m_cfg.gridOptions.toInternalUnits();
+  // the options only reference the region of interest, which is kept alive
+  // by the configuration
+  m_cfg.seedFinderOptions.roi = m_cfg.roi.get();
   if (m_cfg.inputSpacePoints.empty()) {
     throw std::invalid_argument("Missing space point input collections");
   }
@@ -18,6 +18,7 @@
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/EventData/SimSpacePoint.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/TrackFinding/RoiSurfaceSelection.hpp"
 #include "ActsExamples/Utilities/GroupBy.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
 
@@ -94,6 +95,13 @@ ActsExamples::SpacePointMaker::SpacePointMaker(Config cfg,
   for (const auto& geoId : m_cfg.geometrySelection) {
     ACTS_INFO("  " << geoId);
   }
+  if (m_cfg.roi && !m_cfg.roi->isFullscan()) {
+    m_roiSurfaces = selectRoiSurfaces(*m_cfg.trackingGeometry,
+                                      Acts::GeometryContext(), *m_cfg.roi);
+    ACTS_INFO("Restrict space point creation to "
+              << m_roiSurfaces->size() << " surfaces in the RoI");
+  }
+
   auto spBuilderConfig = Acts::SpacePointBuilderConfig();
   spBuilderConfig.trackingGeometry = m_cfg.trackingGeometry;
 
@@ -147,6 +155,9 @@ ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
     auto groupedByModule = makeGroupBy(range, detail::GeometryIdGetter());
 
     for (auto [moduleGeoId, moduleSourceLinks] : groupedByModule) {
+      if (m_roiSurfaces.has_value() && m_roiSurfaces->count(moduleGeoId) == 0) {
+        continue;
+      }
       for (auto& sourceLink : moduleSourceLinks) {
         m_spacePointBuilder.buildSpacePoint(
             ctx.geoContext, {Acts::SourceLink{sourceLink}}, spOpt,
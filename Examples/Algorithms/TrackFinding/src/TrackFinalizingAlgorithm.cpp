@@ -0,0 +1,121 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/TrackFinding/TrackFinalizingAlgorithm.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+ActsExamples::TrackFinalizingAlgorithm::TrackFinalizingAlgorithm(
+    Config config, Acts::Logging::Level level)
+    : ActsExamples::IAlgorithm("TrackFinalizingAlgorithm", level),
+      m_cfg(std::move(config)) {
+  if (m_cfg.inputTracks.empty()) {
+    throw std::invalid_argument("Missing tracks input collection");
+  }
+  if (m_cfg.outputTracks.empty()) {
+    throw std::invalid_argument("Missing tracks output collection");
+  }
+  if (!m_cfg.trackingGeometry) {
+    throw std::invalid_argument("Missing tracking geometry");
+  }
+  if (!m_cfg.magneticField) {
+    throw std::invalid_argument("Missing magnetic field");
+  }
+
+  m_referenceSurface = m_cfg.referenceSurface;
+  if (!m_referenceSurface) {
+    m_referenceSurface = Acts::Surface::makeShared<Acts::PerigeeSurface>(
+        Acts::Vector3{0., 0., 0.});
+  }
+
+  Acts::EigenStepper<> stepper(m_cfg.magneticField);
+  Acts::Navigator::Config navCfg{m_cfg.trackingGeometry};
+  navCfg.resolvePassive = false;
+  navCfg.resolveMaterial = true;
+  navCfg.resolveSensitive = true;
+  Acts::Navigator navigator(navCfg, logger().cloneWithSuffix("Navigator"));
+  m_propagator = std::make_shared<Propagator>(
+      std::move(stepper), std::move(navigator),
+      logger().cloneWithSuffix("Propagator"));
+
+  if (m_cfg.trackSelectorCfg.has_value()) {
+    m_trackSelector.emplace(*m_cfg.trackSelectorCfg);
+  }
+
+  m_inputTracks.initialize(m_cfg.inputTracks);
+  m_outputTracks.initialize(m_cfg.outputTracks);
+}
+
+ActsExamples::ProcessCode ActsExamples::TrackFinalizingAlgorithm::execute(
+    const ActsExamples::AlgorithmContext& ctx) const {
+  const auto& inputTracks = m_inputTracks(ctx);
+
+  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
+  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  TrackContainer tracks(trackContainer, trackStateContainer);
+  tracks.ensureDynamicColumns(inputTracks);
+
+  Acts::PropagatorOptions<> options(ctx.geoContext, ctx.magFieldContext);
+  options.maxSteps = m_cfg.maxSteps;
+
+  Acts::GainMatrixSmoother smoother;
+
+  for (const auto& inputTrack : inputTracks) {
+    m_nTotalTracks++;
+
+    auto track = tracks.getTrack(tracks.addTrack());
+    track.copyFrom(inputTrack, true);
+
+    auto result = Acts::smoothTrack(ctx.geoContext, track, logger(), smoother);
+    if (result.ok()) {
+      result = Acts::extrapolateTrackToReferenceSurface(
+          track, *m_referenceSurface, *m_propagator, options,
+          m_cfg.extrapolationStrategy, logger());
+    }
+    if (!result.ok()) {
+      m_nFailedTracks++;
+      ACTS_WARNING("Finalizing track " << inputTrack.index()
+                                       << " failed with error "
+                                       << result.error());
+      tracks.removeTrack(track.index());
+      continue;
+    }
+
+    if (m_trackSelector.has_value() && !m_trackSelector->isValidTrack(track)) {
+      tracks.removeTrack(track.index());
+    }
+  }
+
+  ACTS_DEBUG("Finalized " << tracks.size() << " tracks from "
+                          << inputTracks.size() << " input tracks");
+
+  ConstTrackContainer constTracks{
+      std::make_shared<Acts::ConstVectorTrackContainer>(
+          std::move(*trackContainer)),
+      std::make_shared<Acts::ConstVectorMultiTrajectory>(
+          std::move(*trackStateContainer))};
+
+  m_outputTracks(ctx, std::move(constTracks));
+  return ActsExamples::ProcessCode::SUCCESS;
+}
+
+ActsExamples::ProcessCode ActsExamples::TrackFinalizingAlgorithm::finalize() {
+  ACTS_INFO("TrackFinalizingAlgorithm statistics:");
+  ACTS_INFO("- total tracks: " << m_nTotalTracks);
+  ACTS_INFO("- failed tracks: " << m_nFailedTracks);
+  return ProcessCode::SUCCESS;
+}
@@ -27,6 +27,7 @@
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/TrackFinding/RoiSurfaceSelection.hpp"
 
 #include <cmath>
 #include <functional>
@@ -64,10 +65,28 @@ ActsExamples::TrackFindingAlgorithm::TrackFindingAlgorithm(
     throw std::invalid_argument("Missing tracks output collection");
   }
 
+  if (!m_cfg.smoothing && m_cfg.trackSelectorCfg.has_value()) {
+    throw std::invalid_argument(
+        "The track selection requires smoothed tracks, select them after "
+        "finalizing the tracks instead");
+  }
+
+  if (m_cfg.roi && !m_cfg.trackingGeometry) {
+    throw std::invalid_argument(
+        "Missing tracking geometry for the region of interest");
+  }
+
   m_inputMeasurements.initialize(m_cfg.inputMeasurements);
   m_inputSourceLinks.initialize(m_cfg.inputSourceLinks);
   m_inputInitialTrackParameters.initialize(m_cfg.inputInitialTrackParameters);
   m_outputTracks.initialize(m_cfg.outputTracks);
+
+  if (m_cfg.roi && !m_cfg.roi->isFullscan()) {
+    m_roiSurfaces = selectRoiSurfaces(*m_cfg.trackingGeometry,
+                                      Acts::GeometryContext(), *m_cfg.roi);
+    ACTS_INFO("Restrict track finding to " << m_roiSurfaces->size()
+                                           << " surfaces in the RoI");
+  }
 }
 
 ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
@@ -108,6 +127,9 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
 
   IndexSourceLinkAccessor slAccessor;
   slAccessor.container = &sourceLinks;
+  if (m_roiSurfaces.has_value()) {
+    slAccessor.surfaceSelection = &m_roiSurfaces.value();
+  }
   Acts::SourceLinkAccessorDelegate<IndexSourceLinkAccessor::Iterator>
       slAccessorDelegate;
   slAccessorDelegate.connect<&IndexSourceLinkAccessor::range>(&slAccessor);
@@ -118,6 +140,7 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
       extensions, pOptions, pSurface.get());
   options.smoothingTargetSurfaceStrategy =
       Acts::CombinatorialKalmanFilterTargetSurfaceStrategy::first;
+  options.smoothing = m_cfg.smoothing;
 
   // Perform the track finding for all initial parameters
   ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
@@ -163,7 +186,13 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
       if (!m_trackSelector.has_value() ||
           m_trackSelector->isValidTrack(track)) {
         auto destProxy = tracks.getTrack(tracks.addTrack());
-        destProxy.copyFrom(track, true);  // make sure we copy track states!
+        // transfer the track states in bulk instead of state by state
+        // through the proxies, only the track level content is copied here
+        destProxy.copyFrom(track, false);
+        auto [stem, tip] = trackStateContainer->appendTrackStates(
+            *trackStateContainerTemp, track.tipIndex());
+        destProxy.stemIndex() = stem;
+        destProxy.tipIndex() = tip;
       }
     }
   }
@@ -176,12 +205,12 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
   ACTS_DEBUG("Finalized track finding with " << tracks.size()
                                              << " track candidates.");
 
-  m_memoryStatistics.local().hist +=
-      tracks.trackStateContainer().statistics().hist;
-
   auto constTrackStateContainer =
       std::make_shared<Acts::ConstVectorMultiTrajectory>(
-          std::move(*trackStateContainer));
+          std::move(*trackStateContainer), m_cfg.trackStateCovarianceStorage);
+
+  m_memoryStatistics.local().hist +=
+      constTrackStateContainer->statistics().hist;
 
   auto constTrackContainer = std::make_shared<Acts::ConstVectorTrackContainer>(
       std::move(*trackContainer));
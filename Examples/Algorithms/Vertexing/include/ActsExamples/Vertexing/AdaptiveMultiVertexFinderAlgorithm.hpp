@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
@@ -77,6 +78,11 @@ class AdaptiveMultiVertexFinderAlgorithm final : public IAlgorithm {
     bool useTime = false;
     /// The magnetic field
     std::shared_ptr<Acts::MagneticFieldProvider> bField;
+    /// Minimum width of the z-slices in which vertices are found in parallel.
+    /// The full event is processed at once if not positive.
+    double zSliceWidth = 0;
+    /// Tracks within this distance of a z-slice are also used in it
+    double zSliceOverlap = 5 * Acts::UnitConstants::mm;
   };
 
   AdaptiveMultiVertexFinderAlgorithm(const Config& config,
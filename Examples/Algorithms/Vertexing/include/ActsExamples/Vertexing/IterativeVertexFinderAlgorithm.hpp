@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/Charge.hpp"
 #include "Acts/EventData/GenericBoundTrackParameters.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
@@ -74,6 +75,11 @@ class IterativeVertexFinderAlgorithm final : public IAlgorithm {
     std::string outputVertices = "vertices";
     /// The magnetic field
     std::shared_ptr<Acts::MagneticFieldProvider> bField;
+    /// Minimum width of the z-slices in which vertices are found in parallel.
+    /// The full event is processed at once if not positive.
+    double zSliceWidth = 0;
+    /// Tracks within this distance of a z-slice are also used in it
+    double zSliceOverlap = 5 * Acts::UnitConstants::mm;
   };
 
   IterativeVertexFinderAlgorithm(const Config& config,
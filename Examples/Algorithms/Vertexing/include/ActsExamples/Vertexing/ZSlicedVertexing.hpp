@@ -0,0 +1,208 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Common.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Vertexing/TrackAtVertex.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Configuration of the event-level z-slicing of vertex finding.
+struct ZSlicingConfig {
+  /// Minimum z width of a slice. A single slice is used if not positive.
+  double sliceWidth = 0;
+  /// Tracks within this distance of a slice are also given to it
+  double overlap = 5.;
+  /// Number of standard deviations of z0 added to the overlap per track
+  double nSigmaZ0 = 3.;
+};
+
+/// A z-slice of the tracks of an event.
+struct ZSlice {
+  /// The vertices between these bounds are owned by the slice
+  double zMin = -std::numeric_limits<double>::infinity();
+  double zMax = std::numeric_limits<double>::infinity();
+  /// Tracks compatible with the slice including its overlap
+  std::vector<const Acts::BoundTrackParameters*> tracks;
+};
+
+/// Partition tracks into overlapping z-slices.
+///
+/// Slice boundaries are placed half-way between two tracks once a slice is
+/// at least `sliceWidth` wide, so every slice contains tracks. The slices
+/// cover the full z range without gaps. A track is added to every slice it
+/// is within `overlap + nSigmaZ0 * sigma(z0)` of, so that vertices close to
+/// a boundary are found with their complete set of tracks.
+///
+/// @param tracks all tracks of the event
+/// @param cfg the slicing configuration
+/// @return the slices ordered by z
+inline std::vector<ZSlice> makeZSlices(
+    const std::vector<const Acts::BoundTrackParameters*>& tracks,
+    const ZSlicingConfig& cfg) {
+  auto z0 = [](const Acts::BoundTrackParameters* trk) {
+    return trk->parameters()[Acts::eBoundLoc1];
+  };
+
+  std::vector<const Acts::BoundTrackParameters*> sorted = tracks;
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [&](const auto* a, const auto* b) { return z0(a) < z0(b); });
+
+  std::vector<ZSlice> slices(1);
+  if (sorted.empty() || cfg.sliceWidth <= 0) {
+    slices.front().tracks = tracks;
+    return slices;
+  }
+  double sliceStart = z0(sorted.front());
+  for (std::size_t i = 1; i < sorted.size(); ++i) {
+    if (z0(sorted[i]) - sliceStart >= cfg.sliceWidth &&
+        z0(sorted[i]) > z0(sorted[i - 1])) {
+      double boundary = 0.5 * (z0(sorted[i - 1]) + z0(sorted[i]));
+      slices.back().zMax = boundary;
+      slices.emplace_back().zMin = boundary;
+      sliceStart = z0(sorted[i]);
+    }
+  }
+
+  for (const auto* trk : tracks) {
+    double sigma = 0;
+    if (trk->covariance().has_value()) {
+      sigma = std::sqrt(std::max(
+          (*trk->covariance())(Acts::eBoundLoc1, Acts::eBoundLoc1), 0.));
+    }
+    const double reach = cfg.overlap + cfg.nSigmaZ0 * sigma;
+    for (auto& slice : slices) {
+      if (slice.zMin - reach < z0(trk) && z0(trk) < slice.zMax + reach) {
+        slice.tracks.push_back(trk);
+      }
+    }
+  }
+
+  return slices;
+}
+
+/// Remove the tracks attached to vertices of more than one z-slice.
+///
+/// A track in the overlap of two slices can be attached to a vertex found
+/// in each of them. Such a track is kept only by the slice where it has the
+/// largest weight at a vertex, or the first of these slices on ties, and is
+/// removed from the vertices of all other slices. Tracks shared between
+/// vertices of the same slice are left untouched, as the finder intends
+/// them. The vertex positions are not refitted.
+///
+/// @param vertices the vertices of all slices
+/// @param vertexSlices the slice index of each vertex
+inline void removeDoubleSliceAssignments(
+    std::vector<Acts::Vertex<Acts::BoundTrackParameters>>& vertices,
+    const std::vector<std::size_t>& vertexSlices) {
+  // slice and weight of the best assignment of each track
+  std::unordered_map<const Acts::BoundTrackParameters*,
+                     std::pair<std::size_t, double>>
+      bestSlice;
+  for (std::size_t iv = 0; iv < vertices.size(); ++iv) {
+    for (const auto& trk : vertices[iv].tracks()) {
+      auto [it, inserted] = bestSlice.try_emplace(
+          trk.originalParams, vertexSlices[iv], trk.trackWeight);
+      if (!inserted && trk.trackWeight > it->second.second) {
+        it->second = {vertexSlices[iv], trk.trackWeight};
+      }
+    }
+  }
+
+  for (std::size_t iv = 0; iv < vertices.size(); ++iv) {
+    const auto& tracks = vertices[iv].tracks();
+    auto isOwned = [&](const auto& trk) {
+      return bestSlice.at(trk.originalParams).first == vertexSlices[iv];
+    };
+    if (std::all_of(tracks.begin(), tracks.end(), isOwned)) {
+      continue;
+    }
+    std::vector<Acts::TrackAtVertex<Acts::BoundTrackParameters>> owned;
+    std::copy_if(tracks.begin(), tracks.end(), std::back_inserter(owned),
+                 isOwned);
+    vertices[iv].setTracksAtVertex(std::move(owned));
+  }
+}
+
+/// Run vertex finding independently, and in parallel, in z-slices of an event.
+///
+/// Every vertex is kept only by the slice whose bounds contain its z
+/// position, which removes the duplicates found in the overlap of two
+/// neighbouring slices. Tracks attached to kept vertices of two slices are
+/// then given to one of them, see @c removeDoubleSliceAssignments.
+///
+/// @param tracks all tracks of the event
+/// @param cfg the slicing configuration
+/// @param findInSlice callable running the vertex finder on a list of tracks
+/// @param logger the logger of the calling algorithm
+/// @return the vertices of all slices ordered by slice
+template <typename find_t>
+std::vector<Acts::Vertex<Acts::BoundTrackParameters>> findVerticesInZSlices(
+    const std::vector<const Acts::BoundTrackParameters*>& tracks,
+    const ZSlicingConfig& cfg, const find_t& findInSlice,
+    const Acts::Logger& logger) {
+  using VertexCollection =
+      std::vector<Acts::Vertex<Acts::BoundTrackParameters>>;
+
+  std::vector<ZSlice> slices = makeZSlices(tracks, cfg);
+  ACTS_DEBUG("Split " << tracks.size() << " tracks into " << slices.size()
+                      << " z-slices");
+
+  std::vector<VertexCollection> sliceVertices(slices.size());
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, slices.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          const ZSlice& slice = slices[i];
+          if (slice.tracks.empty()) {
+            continue;
+          }
+          Acts::Result<VertexCollection> result = findInSlice(slice.tracks);
+          if (!result.ok()) {
+            ACTS_ERROR("Error in vertex finder in z-slice ["
+                       << slice.zMin << ", " << slice.zMax
+                       << "): " << result.error().message());
+            continue;
+          }
+          for (auto& vtx : *result) {
+            const double z = vtx.position()[Acts::eZ];
+            if (slice.zMin <= z && z < slice.zMax) {
+              sliceVertices[i].push_back(std::move(vtx));
+            }
+          }
+        }
+      });
+
+  VertexCollection vertices;
+  std::vector<std::size_t> vertexSlices;
+  for (std::size_t i = 0; i < sliceVertices.size(); ++i) {
+    auto& vs = sliceVertices[i];
+    vertexSlices.insert(vertexSlices.end(), vs.size(), i);
+    std::move(vs.begin(), vs.end(), std::back_inserter(vertices));
+  }
+  removeDoubleSliceAssignments(vertices, vertexSlices);
+  return vertices;
+}
+
+}  // namespace ActsExamples
@@ -22,12 +22,14 @@
 #include "ActsExamples/EventData/ProtoVertex.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Vertexing/ZSlicedVertexing.hpp"
 
 #include <memory>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <system_error>
+#include <vector>
 
 #include "VertexingHelpers.hpp"
 
@@ -173,13 +175,27 @@ ActsExamples::AdaptiveMultiVertexFinderAlgorithm::executeAfterSeederChoice(
   } else {
     ACTS_DEBUG("Have " << inputTrackParameters.size()
                        << " input track parameters, running vertexing");
-    // find vertices
-    auto result = finder.find(inputTrackPointers, finderOpts, state);
-
-    if (result.ok()) {
-      vertices = std::move(result.value());
+    if (m_cfg.zSliceWidth > 0) {
+      // find vertices in independent z-slices in parallel
+      ZSlicingConfig slicingCfg;
+      slicingCfg.sliceWidth = m_cfg.zSliceWidth;
+      slicingCfg.overlap = m_cfg.zSliceOverlap;
+      vertices = findVerticesInZSlices(
+          inputTrackPointers, slicingCfg,
+          [&](const std::vector<const Acts::BoundTrackParameters*>& tracks) {
+            typename Finder::State sliceState;
+            return finder.find(tracks, finderOpts, sliceState);
+          },
+          logger());
     } else {
-      ACTS_ERROR("Error in vertex finder: " << result.error().message());
+      // find vertices
+      auto result = finder.find(inputTrackPointers, finderOpts, state);
+
+      if (result.ok()) {
+        vertices = std::move(result.value());
+      } else {
+        ACTS_ERROR("Error in vertex finder: " << result.error().message());
+      }
     }
   }
 
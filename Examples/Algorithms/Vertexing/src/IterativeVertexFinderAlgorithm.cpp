@@ -17,11 +17,13 @@
 #include "Acts/Vertexing/Vertex.hpp"
 #include "ActsExamples/EventData/ProtoVertex.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Vertexing/ZSlicedVertexing.hpp"
 
 #include <chrono>
 #include <ostream>
 #include <stdexcept>
 #include <system_error>
+#include <vector>
 
 #include "VertexingHelpers.hpp"
 
@@ -92,17 +94,32 @@ ActsExamples::ProcessCode ActsExamples::IterativeVertexFinderAlgorithm::execute(
   finderCfg.maxVertices = 200;
   finderCfg.reassignTracksAfterFirstFit = false;
   Finder finder(std::move(finderCfg), logger().clone());
-  Finder::State state(*m_cfg.bField, ctx.magFieldContext);
   Options finderOpts(ctx.geoContext, ctx.magFieldContext);
 
-  // find vertices
-  auto result = finder.find(inputTrackPointers, finderOpts, state);
-
   VertexCollection vertices;
-  if (result.ok()) {
-    vertices = std::move(result.value());
+  if (m_cfg.zSliceWidth > 0) {
+    // find vertices in independent z-slices in parallel
+    ZSlicingConfig slicingCfg;
+    slicingCfg.sliceWidth = m_cfg.zSliceWidth;
+    slicingCfg.overlap = m_cfg.zSliceOverlap;
+    vertices = findVerticesInZSlices(
+        inputTrackPointers, slicingCfg,
+        [&](const std::vector<const Acts::BoundTrackParameters*>& tracks) {
+          Finder::State sliceState(*m_cfg.bField, ctx.magFieldContext);
+          return finder.find(tracks, finderOpts, sliceState);
+        },
+        logger());
   } else {
-    ACTS_ERROR("Error in vertex finder: " << result.error().message());
+    Finder::State state(*m_cfg.bField, ctx.magFieldContext);
+
+    // find vertices
+    auto result = finder.find(inputTrackPointers, finderOpts, state);
+
+    if (result.ok()) {
+      vertices = std::move(result.value());
+    } else {
+      ACTS_ERROR("Error in vertex finder: " << result.error().message());
+    }
   }
 
   // show some debug output
@@ -58,6 +58,8 @@ class AlignedDetector {
     double sigmaOutRot = 0;
     /// Keep the first iov batch nominal.
     bool firstIovNominal = false;
+    /// Number of upcoming IOVs prepared in the background (external mode).
+    unsigned int nPrefetchIovs = 0;
     /// Log level for the decorator
     Acts::Logging::Level decoratorLogLevel = Acts::Logging::INFO;
 
@@ -17,13 +17,17 @@
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
+#include <atomic>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include <tbb/task_group.h>
+
 namespace Acts {
 class TrackingGeometry;
 }
@@ -38,12 +42,24 @@ namespace Contextual {
 ///
 /// It acts on the PayloadDetectorElement, i.e. the
 /// geometry context carries the full transform store (payload)
+///
+/// The transforms of an IOV are generated outside of the IOV lock into an
+/// immutable store, optionally ahead of time for upcoming IOVs in background
+/// tasks. Events only wait for the IOV they belong to, and a store is
+/// released once it is stale and no event in flight refers to it anymore.
+///
+/// @note The random engine of an IOV is seeded with the first event of the
+/// IOV, such that the misalignment does not depend on which event requests
+/// it first. This changes the misalignment with respect to versions which
+/// seeded with the requesting event.
 class ExternalAlignmentDecorator : public AlignmentDecorator {
  public:
   /// @brief nested configuration struct
   struct Config : public AlignmentDecorator::Config {
     /// The trackng geometry
     std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry = nullptr;
+    /// Number of upcoming IOVs prepared in the background
+    unsigned int nPrefetchIovs = 0;
   };
 
   /// Constructor
@@ -55,8 +71,8 @@ class ExternalAlignmentDecorator : public AlignmentDecorator {
       std::unique_ptr<const Acts::Logger> logger = Acts::getDefaultLogger(
           "ExternalAlignmentDecorator", Acts::Logging::INFO));
 
-  /// Virtual destructor
-  ~ExternalAlignmentDecorator() override = default;
+  /// Virtual destructor, waits for the background tasks
+  ~ExternalAlignmentDecorator() noexcept override;
 
   /// @brief decorates (adds, modifies) the AlgorithmContext
   /// with a geometric rotation per event
@@ -78,18 +94,49 @@ class ExternalAlignmentDecorator : public AlignmentDecorator {
   /// Map of nominal transforms
   std::vector<Acts::Transform3> m_nominalStore;
 
-  std::unordered_map<
-      unsigned int,
-      std::shared_ptr<ExternallyAlignedDetectorElement::AlignmentStore>>
-      m_activeIovs;
+  using AlignmentStore = ExternallyAlignedDetectorElement::AlignmentStore;
+
+  /// The alignment store of an IOV, prepared either by a background task or
+  /// by the first event which needs it
+  struct IovStore {
+    std::once_flag once;
+    std::atomic<bool> ready{false};
+    std::shared_ptr<const AlignmentStore> store;
+    std::function<std::shared_ptr<const AlignmentStore>()> prepare;
+
+    /// Get the store, prepares it or waits for its preparation if needed
+    const std::shared_ptr<const AlignmentStore>& get();
+  };
+
+  struct IovStatus {
+    std::shared_ptr<IovStore> store;
+    std::size_t lastAccessed = 0;
+    /// Number of events which obtained the store but do not hold it yet
+    std::size_t nPending = 0;
+  };
+
+  std::unordered_map<unsigned int, IovStatus> m_activeIovs;
 
   std::mutex m_iovMutex;
 
+  /// The background tasks preparing upcoming IOVs
+  tbb::task_group m_prefetchTasks;
+
   std::size_t m_eventsSeen{0};
 
   /// Private access to the logging instance
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// Find the status of an IOV and start preparing its store if needed
+  ///
+  /// @note Needs to be called with the IOV mutex locked
+  ///
+  /// @param context the context of the current event, used for seeding
+  /// @param iov the IOV to find
+  /// @param prefetch whether a new store is prepared in a background task
+  IovStatus& findOrPrepareIov(const AlgorithmContext& context,
+                              unsigned int iov, bool prefetch);
+
   /// Populate the nominal transforms
   /// this parses the TrackingGeometry and fills the nominal store
   ///
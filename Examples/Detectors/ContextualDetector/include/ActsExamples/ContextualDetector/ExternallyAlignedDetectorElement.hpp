@@ -44,7 +44,8 @@ class ExternallyAlignedDetectorElement
   struct AlignmentStore {
     // GenericDetector identifiers are sequential
     std::vector<Acts::Transform3> transforms;
-    std::size_t lastAccessed = 0;
+    // The inverse transforms, if computed together with the transforms
+    std::vector<Acts::Transform3> inverseTransforms;
   };
 
   /// @class ContextType
@@ -63,6 +64,14 @@ class ExternallyAlignedDetectorElement
   /// @note this is called from the surface().transform(gctx)
   const Acts::Transform3& transform(
       const Acts::GeometryContext& gctx) const override;
+
+  /// Return global to local transform associated with this identifier
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  ///
+  /// @note the inverse is taken from the alignment store if it provides it
+  Acts::Transform3 inverseTransform(
+      const Acts::GeometryContext& gctx) const override;
 };
 
 inline const Acts::Transform3& ExternallyAlignedDetectorElement::transform(
@@ -84,5 +93,23 @@ inline const Acts::Transform3& ExternallyAlignedDetectorElement::transform(
   return alignContext.alignmentStore->transforms[idValue];
 }
 
+inline Acts::Transform3 ExternallyAlignedDetectorElement::inverseTransform(
+    const Acts::GeometryContext& gctx) const {
+  if (!gctx.hasValue()) {  // Treating empty context => nominal alignment
+    return GenericDetectorElement::inverseTransform(gctx);
+  }
+  const auto& alignContext = gctx.get<ContextType>();
+  if (alignContext.alignmentStore == nullptr) {
+    return GenericDetectorElement::inverseTransform(gctx);
+  }
+  identifier_type idValue = identifier_type(identifier());
+  const auto& inverseTransforms =
+      alignContext.alignmentStore->inverseTransforms;
+  if (idValue < inverseTransforms.size()) {
+    return inverseTransforms[idValue];
+  }
+  return transform(gctx).inverse(Eigen::Isometry);
+}
+
 }  // end of namespace Contextual
 }  // end of namespace ActsExamples
@@ -20,6 +20,7 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
 
 namespace ActsExamples {
 
@@ -57,6 +58,14 @@ class InternallyAlignedDetectorElement
   const Acts::Transform3& transform(
       const Acts::GeometryContext& gctx) const override;
 
+  /// Return global to local transform associated with this identifier
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  ///
+  /// @note the inverse is cached together with the aligned transform
+  Acts::Transform3 inverseTransform(
+      const Acts::GeometryContext& gctx) const override;
+
   /// Return the nominal local to global transform
   ///
   /// @note the geometry context will hereby be ignored
@@ -73,7 +82,16 @@ class InternallyAlignedDetectorElement
   void clearAlignedTransform(unsigned int iov);
 
  private:
-  std::unordered_map<unsigned int, Acts::Transform3> m_alignedTransforms;
+  /// Find the aligned transforms of the IOV of the context
+  ///
+  /// @note Needs to be called with the alignment mutex locked
+  const std::pair<Acts::Transform3, Acts::Transform3>& alignedTransforms(
+      const ContextType& alignContext) const;
+
+  /// The aligned transform and its inverse per IOV
+  std::unordered_map<unsigned int,
+                     std::pair<Acts::Transform3, Acts::Transform3>>
+      m_alignedTransforms;
   mutable std::mutex m_alignmentMutex;
 };
 
@@ -90,6 +108,28 @@ inline const Acts::Transform3& InternallyAlignedDetectorElement::transform(
     // nominal alignment
     return nominalTransform(gctx);
   }
+  return alignedTransforms(alignContext).first;
+}
+
+inline Acts::Transform3 InternallyAlignedDetectorElement::inverseTransform(
+    const Acts::GeometryContext& gctx) const {
+  if (!gctx.hasValue()) {
+    // Return the standard inverse transform if geo context is empty
+    return GenericDetectorElement::inverseTransform(gctx);
+  }
+  const auto& alignContext = gctx.get<ContextType&>();
+
+  std::lock_guard lock{m_alignmentMutex};
+  if (alignContext.nominal) {
+    // nominal alignment
+    return GenericDetectorElement::inverseTransform(gctx);
+  }
+  return alignedTransforms(alignContext).second;
+}
+
+inline const std::pair<Acts::Transform3, Acts::Transform3>&
+InternallyAlignedDetectorElement::alignedTransforms(
+    const ContextType& alignContext) const {
   auto aTransform = m_alignedTransforms.find(alignContext.iov);
   if (aTransform == m_alignedTransforms.end()) {
     throw std::runtime_error{
@@ -109,7 +149,8 @@ InternallyAlignedDetectorElement::nominalTransform(
 inline void InternallyAlignedDetectorElement::addAlignedTransform(
     const Acts::Transform3& alignedTransform, unsigned int iov) {
   std::lock_guard lock{m_alignmentMutex};
-  m_alignedTransforms[iov] = alignedTransform;
+  m_alignedTransforms[iov] = {alignedTransform,
+                             alignedTransform.inverse(Eigen::Isometry)};
 }
 
 inline void InternallyAlignedDetectorElement::clearAlignedTransform(
@@ -58,6 +58,7 @@ auto AlignedDetector::finalize(
 
     ExternalAlignmentDecorator::Config agcsConfig;
     fillDecoratorConfig(agcsConfig);
+    agcsConfig.nPrefetchIovs = cfg.nPrefetchIovs;
 
     std::vector<std::vector<std::shared_ptr<ExternallyAlignedDetectorElement>>>
         detectorStore;
@@ -30,70 +30,128 @@ ActsExamples::Contextual::ExternalAlignmentDecorator::
   }
 }
 
+ActsExamples::Contextual::ExternalAlignmentDecorator::
+    ~ExternalAlignmentDecorator() noexcept {
+  m_prefetchTasks.wait();
+}
+
+auto ActsExamples::Contextual::ExternalAlignmentDecorator::IovStore::get()
+    -> const std::shared_ptr<const AlignmentStore>& {
+  std::call_once(once, [this]() {
+    store = prepare();
+    ready = true;
+  });
+  return store;
+}
+
 ActsExamples::ProcessCode
 ActsExamples::Contextual::ExternalAlignmentDecorator::decorate(
     AlgorithmContext& context) {
-  // Iov map access needs to be synchronized
-  std::lock_guard lock{m_iovMutex};
-
   // In which iov batch are we?
   unsigned int iov = context.eventNumber / m_cfg.iovSize;
   ACTS_VERBOSE("IOV handling in thread " << std::this_thread::get_id() << ".");
   ACTS_VERBOSE("IOV resolved to " << iov << " - from event "
                                   << context.eventNumber << ".");
 
-  m_eventsSeen++;
+  std::shared_ptr<IovStore> store;
+  {
+    // Iov map access needs to be synchronized, the stores are prepared
+    // outside of the lock
+    std::lock_guard lock{m_iovMutex};
+
+    m_eventsSeen++;
+
+    if (m_cfg.randomNumberSvc != nullptr) {
+      IovStatus& status = findOrPrepareIov(context, iov, false);
+      status.lastAccessed = m_eventsSeen;
+      // The store is not referenced by this event until it is set in the
+      // context below, which needs to be known to the garbage collection
+      ++status.nPending;
+      store = status.store;
+
+      // Prepare the upcoming iovs in the background
+      for (unsigned int iNext = 1; iNext <= m_cfg.nPrefetchIovs; ++iNext) {
+        findOrPrepareIov(context, iov + iNext, true);
+      }
+    }
 
-  if (m_cfg.randomNumberSvc != nullptr) {
-    if (auto it = m_activeIovs.find(iov); it != m_activeIovs.end()) {
-      // Iov is already present, update last accessed
-      it->second->lastAccessed = m_eventsSeen;
-      context.geoContext =
-          ExternallyAlignedDetectorElement::ContextType{it->second};
-    } else {
-      // Iov is not present yet, create it
-      auto alignmentStore =
-          std::make_unique<ExternallyAlignedDetectorElement::AlignmentStore>();
-      alignmentStore->lastAccessed = m_eventsSeen;
-
-      ACTS_VERBOSE("New IOV " << iov << " detected at event "
-                              << context.eventNumber
-                              << ", emulate new alignment.");
-
-      // Create an algorithm local random number generator
-      RandomEngine rng = m_cfg.randomNumberSvc->spawnGenerator(context);
-
-      alignmentStore->transforms = m_nominalStore;  // copy nominal alignment
-      for (auto& tForm : alignmentStore->transforms) {
-        // Multiply alignment in place
-        applyTransform(tForm, m_cfg, rng, iov);
+    // Garbage collection
+    if (m_cfg.doGarbageCollection) {
+      for (auto it = m_activeIovs.begin(); it != m_activeIovs.end();) {
+        auto& status = it->second;
+        // Only finished stores not referenced by any event in flight
+        bool released = status.nPending == 0 && status.store->ready &&
+                        status.store->store.use_count() == 1;
+        if (m_eventsSeen - status.lastAccessed > m_cfg.flushSize && released) {
+          ACTS_DEBUG("IOV " << it->first
+                            << " has not been accessed in the last "
+                            << m_cfg.flushSize << " events, clearing");
+          it = m_activeIovs.erase(it);
+        } else {
+          it++;
+        }
       }
+    }
+  }
 
-      auto [insertIterator, inserted] =
-          m_activeIovs.emplace(iov, std::move(alignmentStore));
-      assert(inserted && "Expected IOV to be created in map, but wasn't");
+  if (store != nullptr) {
+    // make context from the store, prepares it or waits if it is still being
+    // prepared
+    context.geoContext =
+        ExternallyAlignedDetectorElement::ContextType{store->get()};
 
-      // make context from iov pointer, address should be stable
-      context.geoContext =
-          ExternallyAlignedDetectorElement::ContextType{insertIterator->second};
+    // The context now holds a reference to the store
+    std::lock_guard lock{m_iovMutex};
+    if (auto it = m_activeIovs.find(iov); it != m_activeIovs.end()) {
+      --it->second.nPending;
     }
   }
 
-  // Garbage collection
-  if (m_cfg.doGarbageCollection) {
-    for (auto it = m_activeIovs.begin(); it != m_activeIovs.end();) {
-      auto& status = it->second;
-      if (m_eventsSeen - status->lastAccessed > m_cfg.flushSize) {
-        ACTS_DEBUG("IOV " << iov << " has not been accessed in the last "
-                          << m_cfg.flushSize << " events, clearing");
-        it = m_activeIovs.erase(it);
-      } else {
-        it++;
-      }
+  return ProcessCode::SUCCESS;
+}
+
+auto ActsExamples::Contextual::ExternalAlignmentDecorator::findOrPrepareIov(
+    const AlgorithmContext& context, unsigned int iov, bool prefetch)
+    -> IovStatus& {
+  if (auto it = m_activeIovs.find(iov); it != m_activeIovs.end()) {
+    return it->second;
+  }
+
+  ACTS_VERBOSE("New IOV " << iov << " requested at event "
+                          << context.eventNumber
+                          << ", emulate new alignment.");
+
+  // Seed with the first event of the iov, such that the alignment does not
+  // depend on which event requests it first
+  AlgorithmContext iovContext(context.algorithmNumber,
+                              static_cast<std::size_t>(iov) * m_cfg.iovSize,
+                              context.eventStore);
+  RandomEngine rng = m_cfg.randomNumberSvc->spawnGenerator(iovContext);
+
+  IovStatus status;
+  status.lastAccessed = m_eventsSeen;
+  status.store = std::make_shared<IovStore>();
+  status.store->prepare = [this, rng, iov]() mutable {
+    auto alignmentStore = std::make_shared<AlignmentStore>();
+    alignmentStore->transforms = m_nominalStore;  // copy nominal alignment
+    alignmentStore->inverseTransforms.reserve(m_nominalStore.size());
+    for (auto& tForm : alignmentStore->transforms) {
+      // Multiply alignment in place
+      applyTransform(tForm, m_cfg, rng, iov);
+      alignmentStore->inverseTransforms.push_back(
+          tForm.inverse(Eigen::Isometry));
     }
+    return std::shared_ptr<const AlignmentStore>(std::move(alignmentStore));
+  };
+  if (prefetch) {
+    // If the task did not run yet, the first event of the IOV prepares the
+    // store itself
+    m_prefetchTasks.run([store = status.store]() { store->get(); });
   }
 
-  return ProcessCode::SUCCESS;
+  auto [insertIterator, inserted] = m_activeIovs.emplace(iov, status);
+  assert(inserted && "Expected IOV to be created in map, but wasn't");
+  return insertIterator->second;
 }
 
 void ActsExamples::Contextual::ExternalAlignmentDecorator::parseGeometry(
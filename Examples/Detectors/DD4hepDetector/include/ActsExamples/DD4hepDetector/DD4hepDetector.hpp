@@ -48,6 +48,10 @@ struct DD4hepDetector {
       std::shared_ptr<const Acts::IMaterialDecorator> mdecorator);
 
   std::shared_ptr<Acts::DD4hepFieldAdapter> field() const;
+
+  /// The field sampled once on a regular grid and interpolated within it
+  std::shared_ptr<Acts::DD4hepFieldAdapter> tabulatedField(
+      const Acts::DD4hepFieldAdapter::Tabulation& tabulation) const;
 };
 
 }  // namespace DD4hep
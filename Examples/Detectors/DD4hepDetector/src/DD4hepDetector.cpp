@@ -57,5 +57,13 @@ std::shared_ptr<Acts::DD4hepFieldAdapter> DD4hepDetector::field() const {
   return std::make_shared<Acts::DD4hepFieldAdapter>(detector.field());
 }
 
+std::shared_ptr<Acts::DD4hepFieldAdapter> DD4hepDetector::tabulatedField(
+    const Acts::DD4hepFieldAdapter::Tabulation& tabulation) const {
+  const auto& detector = geometryService->detector();
+
+  return std::make_shared<Acts::DD4hepFieldAdapter>(detector.field(),
+                                                    tabulation);
+}
+
 }  // namespace DD4hep
 }  // namespace ActsExamples
@@ -83,6 +83,12 @@ class GenericDetectorElement : public Acts::IdentifiedDetectorElement {
   const Acts::Transform3& transform(
       const Acts::GeometryContext& gctx) const override;
 
+  /// Return the cached global to local transform
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  Acts::Transform3 inverseTransform(
+      const Acts::GeometryContext& gctx) const override;
+
   /// Return surface associated with this detector element
   const Acts::Surface& surface() const override;
 
@@ -105,6 +111,8 @@ class GenericDetectorElement : public Acts::IdentifiedDetectorElement {
   Identifier m_elementIdentifier;
   /// the transform for positioning in 3D space
   std::shared_ptr<const Acts::Transform3> m_elementTransform;
+  /// the inverse transform, computed once at construction
+  Acts::Transform3 m_elementInverseTransform;
   /// the surface represented by it
   std::shared_ptr<Acts::Surface> m_elementSurface;
   /// the element thickness
@@ -133,6 +141,12 @@ ActsExamples::Generic::GenericDetectorElement::transform(
   return *m_elementTransform;
 }
 
+inline Acts::Transform3
+ActsExamples::Generic::GenericDetectorElement::inverseTransform(
+    const Acts::GeometryContext& /*gctx*/) const {
+  return m_elementInverseTransform;
+}
+
 inline const Acts::Surface&
 ActsExamples::Generic::GenericDetectorElement::surface() const {
   return *m_elementSurface;
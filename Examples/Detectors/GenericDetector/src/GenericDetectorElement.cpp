@@ -22,6 +22,7 @@ ActsExamples::Generic::GenericDetectorElement::GenericDetectorElement(
     : Acts::IdentifiedDetectorElement(),
       m_elementIdentifier(identifier),
       m_elementTransform(std::move(transform)),
+      m_elementInverseTransform(m_elementTransform->inverse(Eigen::Isometry)),
       m_elementSurface(
           Acts::Surface::makeShared<Acts::PlaneSurface>(pBounds, *this)),
       m_elementThickness(thickness),
@@ -40,6 +41,7 @@ ActsExamples::Generic::GenericDetectorElement::GenericDetectorElement(
     : Acts::IdentifiedDetectorElement(),
       m_elementIdentifier(identifier),
       m_elementTransform(std::move(transform)),
+      m_elementInverseTransform(m_elementTransform->inverse(Eigen::Isometry)),
       m_elementSurface(
           Acts::Surface::makeShared<Acts::DiscSurface>(dBounds, *this)),
       m_elementThickness(thickness),
@@ -0,0 +1,56 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/MagneticField/MagneticField.hpp"
+
+#include <string>
+
+namespace ActsExamples {
+
+/// Write a RZ field map into a binary cache file.
+///
+/// The file contains the grid axes and all grid values (including under- and
+/// overflow bins) in the internal grid order and units. It can be converted
+/// once from a text or ROOT field map and then be loaded with
+/// @c makeMagneticFieldMapRzFromBinary without any parsing, sorting or
+/// per-point filling.
+///
+/// @param[in] map The field map to write
+/// @param[in] fieldMapFile Path of the binary file to create
+void writeMagneticFieldMapRzToBinary(
+    const detail::InterpolatedMagneticField2& map,
+    const std::string& fieldMapFile);
+
+/// Write a XYZ field map into a binary cache file.
+///
+/// @copydetails writeMagneticFieldMapRzToBinary
+void writeMagneticFieldMapXyzToBinary(
+    const detail::InterpolatedMagneticField3& map,
+    const std::string& fieldMapFile);
+
+/// Read a RZ field map from a binary cache file.
+///
+/// The values are read into the grid in a single sequential pass. The units
+/// and the quadrant symmetry have already been applied when the file was
+/// written. The grid owns its values, every process loading the file holds
+/// its own copy of the map.
+///
+/// @param[in] fieldMapFile Path to a file written by
+///            @c writeMagneticFieldMapRzToBinary
+detail::InterpolatedMagneticField2 makeMagneticFieldMapRzFromBinary(
+    const std::string& fieldMapFile);
+
+/// Read a XYZ field map from a binary cache file.
+///
+/// @copydetails makeMagneticFieldMapRzFromBinary
+detail::InterpolatedMagneticField3 makeMagneticFieldMapXyzFromBinary(
+    const std::string& fieldMapFile);
+
+}  // namespace ActsExamples
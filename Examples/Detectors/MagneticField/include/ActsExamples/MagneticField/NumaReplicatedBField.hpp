@@ -0,0 +1,76 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "ActsExamples/Utilities/Numa.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// A magnetic field forwarding to a replica on the NUMA node of the calling
+/// thread.
+///
+/// The replicas are created with `Sequencer::replicatePerNumaNode`, e.g. from
+/// a field map, so that the field lookups of the event loop only touch
+/// node-local memory. The replica is selected in `makeCache` and in every
+/// lookup, hence a cache must only be used on the thread that created it.
+class NumaReplicatedBField final : public Acts::MagneticFieldProvider {
+ public:
+  /// @brief construct from the per-node replicas
+  ///
+  /// @param [in] replicas the field replicas, one per NUMA node
+  explicit NumaReplicatedBField(
+      std::vector<std::shared_ptr<const Acts::MagneticFieldProvider>> replicas)
+      : m_replicas(std::move(replicas)) {
+    if (m_replicas.empty()) {
+      throw std::invalid_argument("Missing magnetic field replicas");
+    }
+    for (const auto& replica : m_replicas) {
+      if (!replica) {
+        throw std::invalid_argument("Invalid magnetic field replica");
+      }
+    }
+  }
+
+  /// @copydoc Acts::MagneticFieldProvider::getField
+  Acts::Result<Acts::Vector3> getField(const Acts::Vector3& position,
+                                       Cache& cache) const override {
+    return local().getField(position, cache);
+  }
+
+  /// @copydoc Acts::MagneticFieldProvider::getFieldGradient
+  Acts::Result<Acts::Vector3> getFieldGradient(
+      const Acts::Vector3& position, Acts::ActsMatrix<3, 3>& derivative,
+      Cache& cache) const override {
+    return local().getFieldGradient(position, derivative, cache);
+  }
+
+  /// @copydoc Acts::MagneticFieldProvider::makeCache
+  Cache makeCache(const Acts::MagneticFieldContext& mctx) const override {
+    return local().makeCache(mctx);
+  }
+
+  /// The replica of the NUMA node of the calling thread
+  const Acts::MagneticFieldProvider& local() const {
+    return *m_replicas[currentNumaNode() % m_replicas.size()];
+  }
+
+ private:
+  std::vector<std::shared_ptr<const Acts::MagneticFieldProvider>> m_replicas;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,206 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/MagneticField/FieldMapBinaryIo.hpp"
+
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S', 'B', 'F', 'M', 0};
+constexpr std::uint32_t kVersion = 1;
+
+/// Fixed size file header, followed by the grid values as doubles
+struct Header {
+  std::array<char, 8> magic = kMagic;
+  std::uint32_t version = kVersion;
+  std::uint32_t dimPos = 0;
+  std::uint32_t dimField = 0;
+  /// mirror symmetries, four bits per axis: the axis is mirrored and the
+  /// x, y, z components flip their sign on reflection
+  std::uint32_t mirror = 0;
+  std::array<std::uint64_t, 3> nBins = {0, 0, 0};
+  std::array<double, 3> min = {0, 0, 0};
+  std::array<double, 3> max = {0, 0, 0};
+  std::uint64_t nValues = 0;
+};
+
+template <typename map_t>
+void writeBinary(const map_t& map, const std::string& fieldMapFile) {
+  using Grid_t = typename map_t::Grid;
+  using Field_t = typename Grid_t::value_type;
+  const Grid_t& grid = map.getGrid();
+
+  Header header;
+  header.dimPos = Grid_t::DIM;
+  header.dimField = Field_t::RowsAtCompileTime;
+  const auto nBins = grid.numLocalBins();
+  const auto min = grid.minPosition();
+  const auto max = grid.maxPosition();
+  for (std::size_t i = 0; i < Grid_t::DIM; ++i) {
+    header.nBins[i] = nBins[i];
+    header.min[i] = min[i];
+    header.max[i] = max[i];
+    if (const auto& signs = map.getMirror()[i]; signs.has_value()) {
+      header.mirror |= 1u << (4 * i);
+      for (std::size_t j = 0; j < 3; ++j) {
+        if ((*signs)[j] < 0) {
+          header.mirror |= 1u << (4 * i + 1 + j);
+        }
+      }
+    }
+  }
+  header.nValues = grid.size();
+
+  std::ofstream os(fieldMapFile, std::ios::out | std::ios::binary);
+  if (!os) {
+    throw std::runtime_error("Could not open '" + fieldMapFile +
+                             "' for writing");
+  }
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  for (std::size_t bin = 0; bin < grid.size(); ++bin) {
+    const Field_t& value = grid.at(bin);
+    os.write(reinterpret_cast<const char*>(value.data()),
+             sizeof(double) * Field_t::RowsAtCompileTime);
+  }
+  if (!os) {
+    throw std::runtime_error("Failed to write '" + fieldMapFile + "'");
+  }
+}
+
+template <typename Grid_t, std::size_t... I>
+Grid_t makeGrid(const Header& header, std::index_sequence<I...> /*dims*/) {
+  return Grid_t(std::make_tuple(Acts::detail::EquidistantAxis(
+      header.min[I], header.max[I], header.nBins[I])...));
+}
+
+template <typename map_t>
+map_t readBinary(
+    const std::string& fieldMapFile,
+    std::function<Acts::ActsVector<map_t::DIM_POS>(const Acts::Vector3&)>
+        transformPos,
+    std::function<Acts::Vector3(const typename map_t::FieldType&,
+                                const Acts::Vector3&)>
+        transformBField) {
+  using Grid_t = typename map_t::Grid;
+  using Field_t = typename Grid_t::value_type;
+  constexpr std::size_t dimField = Field_t::RowsAtCompileTime;
+
+  std::ifstream is(fieldMapFile, std::ios::in | std::ios::binary);
+  if (!is) {
+    throw std::runtime_error("Field map file '" + fieldMapFile +
+                             "' does not exist");
+  }
+  is.seekg(0, std::ios::end);
+  const auto fileSize = static_cast<std::size_t>(is.tellg());
+  is.seekg(0, std::ios::beg);
+
+  Header header;
+  if (fileSize < sizeof(header) ||
+      !is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    throw std::runtime_error("'" + fieldMapFile +
+                             "' is not a binary field map");
+  }
+  if (header.magic != kMagic || header.version != kVersion) {
+    throw std::runtime_error("'" + fieldMapFile +
+                             "' is not a binary field map of a known version");
+  }
+  if (header.dimPos != Grid_t::DIM || header.dimField != dimField) {
+    throw std::runtime_error("'" + fieldMapFile +
+                             "' has incompatible field map dimensions");
+  }
+
+  Grid_t grid =
+      makeGrid<Grid_t>(header, std::make_index_sequence<Grid_t::DIM>());
+  if (header.nValues != grid.size() ||
+      fileSize != sizeof(header) + sizeof(double) * dimField * grid.size()) {
+    throw std::runtime_error("'" + fieldMapFile + "' is truncated");
+  }
+
+  // values are stored in the grid order, a single sequential read fills the
+  // grid
+  for (std::size_t bin = 0; bin < grid.size(); ++bin) {
+    is.read(reinterpret_cast<char*>(grid.at(bin).data()),
+            sizeof(double) * dimField);
+  }
+  if (!is) {
+    throw std::runtime_error("Failed to read '" + fieldMapFile + "'");
+  }
+
+  typename map_t::Config config{std::move(transformPos),
+                               std::move(transformBField), std::move(grid)};
+  for (std::size_t i = 0; i < Grid_t::DIM; ++i) {
+    if ((header.mirror & (1u << (4 * i))) != 0) {
+      Acts::Vector3 signs = Acts::Vector3::Ones();
+      for (std::size_t j = 0; j < 3; ++j) {
+        if ((header.mirror & (1u << (4 * i + 1 + j))) != 0) {
+          signs[j] = -1.;
+        }
+      }
+      config.mirror[i] = signs;
+    }
+  }
+  return map_t(std::move(config));
+}
+
+}  // namespace
+
+void ActsExamples::writeMagneticFieldMapRzToBinary(
+    const detail::InterpolatedMagneticField2& map,
+    const std::string& fieldMapFile) {
+  writeBinary(map, fieldMapFile);
+}
+
+void ActsExamples::writeMagneticFieldMapXyzToBinary(
+    const detail::InterpolatedMagneticField3& map,
+    const std::string& fieldMapFile) {
+  writeBinary(map, fieldMapFile);
+}
+
+ActsExamples::detail::InterpolatedMagneticField2
+ActsExamples::makeMagneticFieldMapRzFromBinary(
+    const std::string& fieldMapFile) {
+  // map (x,y,z) -> (r,z)
+  auto transformPos = [](const Acts::Vector3& pos) {
+    return Acts::Vector2(Acts::VectorHelpers::perp(pos), pos.z());
+  };
+  // map (Br,Bz) -> (Bx,By,Bz)
+  auto transformBField = [](const Acts::Vector2& field,
+                            const Acts::Vector3& pos) {
+    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+    double cos_phi = 1., sin_phi = 0.;
+    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+      double inv_r_sin_theta = 1. / std::sqrt(r_sin_theta_2);
+      cos_phi = pos.x() * inv_r_sin_theta;
+      sin_phi = pos.y() * inv_r_sin_theta;
+    }
+    return Acts::Vector3(field.x() * cos_phi, field.x() * sin_phi, field.y());
+  };
+  return readBinary<detail::InterpolatedMagneticField2>(
+      fieldMapFile, transformPos, transformBField);
+}
+
+ActsExamples::detail::InterpolatedMagneticField3
+ActsExamples::makeMagneticFieldMapXyzFromBinary(
+    const std::string& fieldMapFile) {
+  auto transformPos = [](const Acts::Vector3& pos) { return pos; };
+  auto transformBField = [](const Acts::Vector3& field,
+                            const Acts::Vector3& /*pos*/) { return field; };
+  return readBinary<detail::InterpolatedMagneticField3>(
+      fieldMapFile, transformPos, transformBField);
+}
@@ -15,6 +15,7 @@
 #include "ActsExamples/EventData/Index.hpp"
 
 #include <cassert>
+#include <unordered_set>
 
 namespace ActsExamples {
 
@@ -84,9 +85,18 @@ struct IndexSourceLinkAccessor : GeometryIdMultisetAccessor<IndexSourceLink> {
 
   using Iterator = Acts::SourceLinkAdapterIterator<BaseIterator>;
 
+  // optional selection of surfaces, e.g. from a region of interest. source
+  // links on other surfaces are not visible if set
+  const std::unordered_set<Acts::GeometryIdentifier>* surfaceSelection =
+      nullptr;
+
   // get the range of elements with requested geoId
   std::pair<Iterator, Iterator> range(const Acts::Surface& surface) const {
     assert(container != nullptr);
+    if (surfaceSelection != nullptr &&
+        surfaceSelection->count(surface.geometryId()) == 0) {
+      return {Iterator{container->end()}, Iterator{container->end()}};
+    }
     auto [begin, end] = container->equal_range(surface.geometryId());
     return {Iterator{begin}, Iterator{end}};
   }
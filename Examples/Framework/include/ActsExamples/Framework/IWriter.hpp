@@ -16,6 +16,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/SequenceElement.hpp"
 
+#include <cstddef>
 #include <string>
 
 namespace ActsExamples {
@@ -38,6 +39,30 @@ class IWriter : public SequenceElement {
 
   /// Fulfil the algorithm interface
   ProcessCode initialize() override { return ProcessCode::SUCCESS; }
+
+  /// Continue with the output shard of a worker process.
+  ///
+  /// In the multi-process mode of the `Sequencer`, this is called in every
+  /// worker process after the fork and before its event loop. A writer with a
+  /// single output for all events has to continue in a separate output of the
+  /// worker, e.g. named `<stem>_worker<i><ext>`. The parent process does not
+  /// finalize the writers. By default, only writers with per-event outputs
+  /// support the worker processes.
+  ///
+  /// @param worker The index of the worker process
+  /// @return ProcessCode::ABORT if the writer does not support it
+  virtual ProcessCode shardOutput(std::size_t /*worker*/) {
+    return m_perEventOutput ? ProcessCode::SUCCESS : ProcessCode::ABORT;
+  }
+
+ protected:
+  /// @param perEventOutput Whether every event is written to its own output,
+  ///        which needs no sharding for the worker processes
+  explicit IWriter(bool perEventOutput = false)
+      : m_perEventOutput(perEventOutput) {}
+
+ private:
+  bool m_perEventOutput;
 };
 
 }  // namespace ActsExamples
@@ -17,7 +17,9 @@
 #include "ActsExamples/Utilities/tbbWrap.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
+#include <chrono>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <stdexcept>
@@ -28,6 +30,9 @@
 #include <vector>
 
 #include <tbb/enumerable_thread_specific.h>
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <tbb/task_scheduler_observer.h>
+#endif
 
 namespace ActsExamples {
 class DataHandleBase;
@@ -89,6 +94,24 @@ class Sequencer {
     std::vector<FpeMask> fpeMasks{};
     bool failOnFirstFpe = false;
     std::size_t fpeStackTraceLength = 8;
+
+    /// Split the worker threads into one task arena per NUMA node, each
+    /// pinned to its node, and process a contiguous block of events per
+    /// node. Read-only services can be replicated per node with
+    /// `replicatePerNumaNode`. Requires TBB with hwloc support to detect the
+    /// nodes, falls back to a single arena otherwise.
+    bool numaAware = false;
+
+    /// Number of worker processes. If larger than one, the sequence elements
+    /// are initialized once and the worker processes are forked afterwards,
+    /// sharing the initialized state copy-on-write. Each worker processes a
+    /// contiguous block of events with `numThreads` threads and finalizes the
+    /// sequence elements. All writers need to support it with
+    /// `IWriter::shardOutput`. The timing of the workers is merged by the
+    /// parent process, which does not finalize the sequence elements.
+    /// @note No other threads, e.g. of TBB, must be running at the time of
+    /// the fork, `run()` throws otherwise
+    std::size_t numProcesses = 1;
   };
 
   Sequencer(const Config &cfg);
@@ -155,6 +178,37 @@ class Sequencer {
   /// Get const access to the config
   const Config &config() const { return m_cfg; }
 
+  /// Number of NUMA nodes the events are distributed to, 1 if the NUMA mode
+  /// is disabled or unavailable.
+  std::size_t numaNodes() const;
+
+  /// Execute a function on a worker thread of a NUMA node.
+  ///
+  /// Memory allocated by @p func is placed on the node by the first touch
+  /// policy of the operating system.
+  ///
+  /// @param node is the NUMA node index in [0, numaNodes())
+  /// @param func is the function to execute
+  void executeOnNumaNode(std::size_t node, const std::function<void()> &func);
+
+  /// Create one replica of a read-only object per NUMA node.
+  ///
+  /// The replicas are created by @p factory on the respective node, so that
+  /// their memory is local to the threads processing the events of the node.
+  /// The replica for the current thread is `replicas[currentNumaNode()]`.
+  ///
+  /// @param factory creates a new instance of the object
+  /// @return the replicas, one per NUMA node
+  template <typename T>
+  std::vector<std::shared_ptr<const T>> replicatePerNumaNode(
+      const std::function<std::shared_ptr<const T>()> &factory) {
+    std::vector<std::shared_ptr<const T>> replicas(numaNodes());
+    for (std::size_t node = 0; node < replicas.size(); ++node) {
+      executeOnNumaNode(node, [&]() { replicas[node] = factory(); });
+    }
+    return replicas;
+  }
+
  private:
   /// List of all configured algorithm names.
   std::vector<std::string> listAlgorithmNames() const;
@@ -166,6 +220,19 @@ class Sequencer {
 
   void fpeReport() const;
 
+  using Duration = std::chrono::high_resolution_clock::duration;
+
+  /// Process the events in the range and accumulate the timing.
+  void runEventLoop(std::pair<std::size_t, std::size_t> eventsRange,
+                    std::vector<Duration> &clocksAlgorithms);
+
+  /// Process the events in the range in forked worker processes and merge
+  /// their timing.
+  void runWorkerProcesses(std::pair<std::size_t, std::size_t> eventsRange,
+                          std::vector<Duration> &clocksAlgorithms);
+
+  void finalizeElements();
+
   struct SequenceElementWithFpeResult {
     std::shared_ptr<SequenceElement> sequenceElement;
     tbb::enumerable_thread_specific<Acts::FpeMonitor::Result> fpeResult{};
@@ -173,6 +240,11 @@ class Sequencer {
 
   Config m_cfg;
   tbbWrap::task_arena m_taskArena;
+#ifndef ACTS_EXAMPLES_NO_TBB
+  std::vector<std::unique_ptr<tbb::task_arena>> m_numaArenas;
+  /// Set the NUMA node of the threads joining the arena of the node
+  std::vector<std::unique_ptr<tbb::task_scheduler_observer>> m_numaObservers;
+#endif
   std::vector<std::shared_ptr<IContextDecorator>> m_decorators;
   std::vector<std::shared_ptr<IReader>> m_readers;
   std::vector<SequenceElementWithFpeResult> m_sequenceElements;
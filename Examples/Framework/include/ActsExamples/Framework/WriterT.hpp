@@ -49,8 +49,9 @@ class WriterT : public IWriter {
   /// @param objectName The object that should be read from the event store
   /// @param writerName The name of the writer, e.g. for logging output
   /// @param level The internal log level
+  /// @param perEventOutput Whether every event is written to its own output
   WriterT(std::string objectName, std::string writerName,
-          Acts::Logging::Level level);
+          Acts::Logging::Level level, bool perEventOutput = false);
 
   /// Provide the name of the writer
   std::string name() const override;
@@ -85,8 +86,10 @@ class WriterT : public IWriter {
 template <typename write_data_t>
 ActsExamples::WriterT<write_data_t>::WriterT(std::string objectName,
                                              std::string writerName,
-                                             Acts::Logging::Level level)
-    : m_objectName(std::move(objectName)),
+                                             Acts::Logging::Level level,
+                                             bool perEventOutput)
+    : IWriter(perEventOutput),
+      m_objectName(std::move(objectName)),
       m_writerName(std::move(writerName)),
       m_logger(Acts::getDefaultLogger(m_writerName, level)) {
   if (m_objectName.empty()) {
@@ -0,0 +1,29 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+
+namespace ActsExamples {
+
+/// Index of the NUMA node the calling thread processes events for.
+///
+/// If the NUMA mode of the `Sequencer` is enabled, this is set for every
+/// thread while it is in the task arena of a node, including nested parallel
+/// work, and is 0 otherwise. It can be used to select the
+/// node-local replica of read-only data, see
+/// `Sequencer::replicatePerNumaNode`.
+std::size_t currentNumaNode();
+
+namespace detail {
+/// Set the NUMA node index of the calling thread.
+void setCurrentNumaNode(std::size_t node);
+}  // namespace detail
+
+}  // namespace ActsExamples
@@ -20,6 +20,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Numa.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
 #include <algorithm>
@@ -27,9 +28,12 @@
 #include <cctype>
 #include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <exception>
+#include <filesystem>
 #include <functional>
+#include <iostream>
 #include <iterator>
 #include <limits>
 #include <numeric>
@@ -39,12 +43,17 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <typeinfo>
 
 #include <boost/stacktrace/stacktrace.hpp>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #ifndef ACTS_EXAMPLES_NO_TBB
 #include <TROOT.h>
+#include <tbb/info.h>
+#include <tbb/task_group.h>
 #endif
 
 #include <boost/algorithm/string.hpp>
@@ -101,6 +110,66 @@ std::string demangleAndShorten(std::string name) {
   return name;
 }
 
+#ifndef ACTS_EXAMPLES_NO_TBB
+/// Binds the threads of a NUMA node arena to the node while they are in it
+class NumaNodeObserver : public tbb::task_scheduler_observer {
+ public:
+  NumaNodeObserver(tbb::task_arena& arena, std::size_t node)
+      : tbb::task_scheduler_observer(arena), m_node(node) {
+    observe(true);
+  }
+
+  ~NumaNodeObserver() override { observe(false); }
+
+  void on_scheduler_entry(bool /*isWorker*/) override {
+    detail::setCurrentNumaNode(m_node);
+  }
+
+  void on_scheduler_exit(bool /*isWorker*/) override {
+    detail::setCurrentNumaNode(0);
+  }
+
+ private:
+  std::size_t m_node;
+};
+#endif
+
+bool writeAll(int fd, const void* data, std::size_t size) {
+  const char* ptr = static_cast<const char*>(data);
+  while (size > 0) {
+    ssize_t n = write(fd, ptr, size);
+    if (n <= 0) {
+      return false;
+    }
+    ptr += n;
+    size -= n;
+  }
+  return true;
+}
+
+bool readAll(int fd, void* data, std::size_t size) {
+  char* ptr = static_cast<char*>(data);
+  while (size > 0) {
+    ssize_t n = read(fd, ptr, size);
+    if (n <= 0) {
+      return false;
+    }
+    ptr += n;
+    size -= n;
+  }
+  return true;
+}
+
+/// Number of threads of the current process, 0 if unknown
+std::size_t numProcessThreads() {
+  std::error_code ec;
+  std::filesystem::directory_iterator tasks("/proc/self/task", ec);
+  if (ec) {
+    return 0;
+  }
+  return std::distance(tasks, std::filesystem::directory_iterator());
+}
+
 }  // namespace
 
 Sequencer::Sequencer(const Sequencer::Config& cfg)
@@ -126,6 +195,60 @@ Sequencer::Sequencer(const Sequencer::Config& cfg)
         "ACTS_SEQUENCER_DISABLE_FPEMON");
     m_cfg.trackFpes = false;
   }
+
+  if (m_cfg.numaAware) {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+    if (m_cfg.numThreads == 1 || nodes.size() < 2) {
+      ACTS_WARNING("NUMA mode requested, but there are "
+                   << nodes.size() << " NUMA nodes available for "
+                   << m_cfg.numThreads << " threads. Running without it.");
+    } else {
+      for (std::size_t i = 0; i < nodes.size(); ++i) {
+        // share the requested threads evenly, or use all cores of the node
+        int concurrency = tbb::task_arena::automatic;
+        if (m_cfg.numThreads > 0) {
+          concurrency = std::max<int>(
+              1, m_cfg.numThreads * (i + 1) / nodes.size() -
+                     m_cfg.numThreads * i / nodes.size());
+        }
+        m_numaArenas.push_back(std::make_unique<tbb::task_arena>(
+            tbb::task_arena::constraints(nodes[i], concurrency)));
+        m_numaObservers.push_back(
+            std::make_unique<NumaNodeObserver>(*m_numaArenas.back(), i));
+        ACTS_INFO("Create task arena for NUMA node "
+                  << nodes[i] << " with "
+                  << m_numaArenas.back()->max_concurrency() << " threads");
+      }
+    }
+#else
+    ACTS_WARNING("NUMA mode requested, but TBB is not available");
+#endif
+  }
+}
+
+std::size_t Sequencer::numaNodes() const {
+#ifndef ACTS_EXAMPLES_NO_TBB
+  if (!m_numaArenas.empty()) {
+    return m_numaArenas.size();
+  }
+#endif
+  return 1;
+}
+
+void Sequencer::executeOnNumaNode(std::size_t node,
+                                  const std::function<void()>& func) {
+  if (node >= numaNodes()) {
+    throw std::out_of_range("Invalid NUMA node " + std::to_string(node));
+  }
+#ifndef ACTS_EXAMPLES_NO_TBB
+  if (!m_numaArenas.empty()) {
+    // the calling thread is bound to the node while it joins the arena
+    m_numaArenas[node]->execute(func);
+    return;
+  }
+#endif
+  func();
 }
 
 void Sequencer::addContextDecorator(
@@ -415,7 +538,6 @@ int Sequencer::run() {
   // per-algorithm time measures
   std::vector<std::string> names = listAlgorithmNames();
   std::vector<Duration> clocksAlgorithms(names.size(), Duration::zero());
-  tbbWrap::queuing_mutex clocksAlgorithmsMutex;
 
   // processing only works w/ a well-known number of events
   // error message is already handled by the helper function
@@ -427,6 +549,9 @@ int Sequencer::run() {
   ACTS_INFO("Processing events [" << eventsRange.first << ", "
                                   << eventsRange.second << ")");
   ACTS_INFO("Starting event loop with " << m_cfg.numThreads << " threads");
+  if (m_cfg.numProcesses > 1) {
+    ACTS_INFO("  in " << m_cfg.numProcesses << " worker processes");
+  }
   ACTS_INFO("  " << m_decorators.size() << " context decorators");
   ACTS_INFO("  " << m_sequenceElements.size() << " sequence elements");
 
@@ -461,120 +586,15 @@ int Sequencer::run() {
   }
 
   // execute the parallel event loop
-  std::atomic<std::size_t> nProcessedEvents = 0;
-  std::size_t nTotalEvents = eventsRange.second - eventsRange.first;
-  m_taskArena.execute([&] {
-    tbbWrap::parallel_for(
-        tbb::blocked_range<std::size_t>(eventsRange.first, eventsRange.second),
-        [&](const tbb::blocked_range<std::size_t>& r) {
-          std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                      Duration::zero());
-
-          for (std::size_t event = r.begin(); event != r.end(); ++event) {
-            ACTS_DEBUG("start processing event " << event);
-            m_cfg.iterationCallback();
-            // Use per-event store
-            WhiteBoard eventStore(
-                Acts::getDefaultLogger("EventStore#" + std::to_string(event),
-                                       m_cfg.logLevel),
-                m_whiteboardObjectAliases);
-            // If we ever wanted to run algorithms in parallel, this needs to
-            // be changed to Algorithm context copies
-            AlgorithmContext context(0, event, eventStore);
-            std::size_t ialgo = 0;
-
-            /// Decorate the context
-            for (auto& cdr : m_decorators) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute context decorator: " << cdr->name());
-              if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
-                throw std::runtime_error("Failed to decorate event context");
-              }
-            }
-
-            ACTS_VERBOSE("Execute sequence elements");
-
-            for (auto& [alg, fpe] : m_sequenceElements) {
-              std::optional<Acts::FpeMonitor> mon;
-              if (m_cfg.trackFpes) {
-                mon.emplace();
-                context.fpeMonitor = &mon.value();
-              }
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": "
-                                      << alg->name());
-              if (alg->internalExecute(++context) != ProcessCode::SUCCESS) {
-                ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg)
-                                                << ": " << alg->name());
-                throw std::runtime_error("Failed to process event data");
-              }
-
-              if (mon) {
-                auto& local = fpe.local();
-
-                for (const auto& [count, type, st] :
-                     mon->result().stackTraces()) {
-                  auto [maskLoc, nMasked] = fpeMaskCount(*st, type);
-                  if (nMasked < count) {
-                    std::stringstream ss;
-                    ss << "FPE of type " << type
-                       << " exceeded configured per-event threshold of "
-                       << nMasked << " (mask: " << maskLoc
-                       << ") (seen: " << count << " FPEs)\n"
-                       << Acts::FpeMonitor::stackTraceToString(
-                              *st, m_cfg.fpeStackTraceLength);
-
-                    m_nUnmaskedFpe += (count - nMasked);
-
-                    if (m_cfg.failOnFirstFpe) {
-                      ACTS_ERROR(ss.str());
-                      local.merge(mon->result());  // merge so we get correct
-                                                   // results after throwing
-                      throw FpeFailure{ss.str()};
-                    } else if (!local.contains(type, *st)) {
-                      ACTS_INFO(ss.str());
-                    }
-                  }
-                }
-
-                local.merge(mon->result());
-              }
-              context.fpeMonitor = nullptr;
-            }
-
-            nProcessedEvents++;
-            if (logger().level() <= Acts::Logging::DEBUG) {
-              ACTS_DEBUG("finished event " << event);
-            } else if (nTotalEvents <= 100) {
-              ACTS_INFO("finished event " << event);
-            } else if (nProcessedEvents % 100 == 0) {
-              ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
-                                         << " events processed");
-            }
-          }
-
-          // add timing info to global information
-          {
-            tbbWrap::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
-            for (std::size_t i = 0; i < clocksAlgorithms.size(); ++i) {
-              clocksAlgorithms[i] += localClocksAlgorithms[i];
-            }
-          }
-        });
-  });
-
-  ACTS_VERBOSE("Finalize sequence elements");
-  for (auto& [alg, fpe] : m_sequenceElements) {
-    ACTS_VERBOSE("Finalize " << getAlgorithmType(*alg) << ": " << alg->name());
-    if (alg->finalize() != ProcessCode::SUCCESS) {
-      ACTS_FATAL("Failed to finalize " << getAlgorithmType(*alg) << ": "
-                                       << alg->name());
-      throw std::runtime_error("Failed to process event data");
-    }
+  if (m_cfg.numProcesses > 1) {
+    // the elements are finalized in the worker processes
+    runWorkerProcesses(eventsRange, clocksAlgorithms);
+  } else {
+    runEventLoop(eventsRange, clocksAlgorithms);
+    finalizeElements();
+    fpeReport();
   }
 
-  fpeReport();
-
   // summarize timing
   Duration totalWall = Clock::now() - clockWallStart;
   Duration totalReal = std::accumulate(
@@ -601,6 +621,273 @@ int Sequencer::run() {
   return EXIT_SUCCESS;
 }
 
+void Sequencer::runEventLoop(std::pair<std::size_t, std::size_t> eventsRange,
+                             std::vector<Duration>& clocksAlgorithms) {
+  tbbWrap::queuing_mutex clocksAlgorithmsMutex;
+  std::atomic<std::size_t> nProcessedEvents = 0;
+  std::size_t nTotalEvents = eventsRange.second - eventsRange.first;
+  auto processEvents = [&](const tbb::blocked_range<std::size_t>& r) {
+    std::vector<Duration> localClocksAlgorithms(clocksAlgorithms.size(),
+                                                Duration::zero());
+
+    for (std::size_t event = r.begin(); event != r.end(); ++event) {
+      ACTS_DEBUG("start processing event " << event);
+      m_cfg.iterationCallback();
+      // Use per-event store
+      WhiteBoard eventStore(
+          Acts::getDefaultLogger("EventStore#" + std::to_string(event),
+                                 m_cfg.logLevel),
+          m_whiteboardObjectAliases);
+      // If we ever wanted to run algorithms in parallel, this needs to
+      // be changed to Algorithm context copies
+      AlgorithmContext context(0, event, eventStore);
+      std::size_t ialgo = 0;
+
+      /// Decorate the context
+      for (auto& cdr : m_decorators) {
+        StopWatch sw(localClocksAlgorithms[ialgo++]);
+        ACTS_VERBOSE("Execute context decorator: " << cdr->name());
+        if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to decorate event context");
+        }
+      }
+
+      ACTS_VERBOSE("Execute sequence elements");
+
+      for (auto& [alg, fpe] : m_sequenceElements) {
+        std::optional<Acts::FpeMonitor> mon;
+        if (m_cfg.trackFpes) {
+          mon.emplace();
+          context.fpeMonitor = &mon.value();
+        }
+        StopWatch sw(localClocksAlgorithms[ialgo++]);
+        ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": "
+                                << alg->name());
+        if (alg->internalExecute(++context) != ProcessCode::SUCCESS) {
+          ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg) << ": "
+                                          << alg->name());
+          throw std::runtime_error("Failed to process event data");
+        }
+
+        if (mon) {
+          auto& local = fpe.local();
+
+          for (const auto& [count, type, st] : mon->result().stackTraces()) {
+            auto [maskLoc, nMasked] = fpeMaskCount(*st, type);
+            if (nMasked < count) {
+              std::stringstream ss;
+              ss << "FPE of type " << type
+                 << " exceeded configured per-event threshold of "
+                 << nMasked << " (mask: " << maskLoc
+                 << ") (seen: " << count << " FPEs)\n"
+                 << Acts::FpeMonitor::stackTraceToString(
+                        *st, m_cfg.fpeStackTraceLength);
+
+              m_nUnmaskedFpe += (count - nMasked);
+
+              if (m_cfg.failOnFirstFpe) {
+                ACTS_ERROR(ss.str());
+                local.merge(mon->result());  // merge so we get correct
+                                             // results after throwing
+                throw FpeFailure{ss.str()};
+              } else if (!local.contains(type, *st)) {
+                ACTS_INFO(ss.str());
+              }
+            }
+          }
+
+          local.merge(mon->result());
+        }
+        context.fpeMonitor = nullptr;
+      }
+
+      nProcessedEvents++;
+      if (logger().level() <= Acts::Logging::DEBUG) {
+        ACTS_DEBUG("finished event " << event);
+      } else if (nTotalEvents <= 100) {
+        ACTS_INFO("finished event " << event);
+      } else if (nProcessedEvents % 100 == 0) {
+        ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
+                                   << " events processed");
+      }
+    }
+
+    // add timing info to global information
+    {
+      tbbWrap::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+      for (std::size_t i = 0; i < clocksAlgorithms.size(); ++i) {
+        clocksAlgorithms[i] += localClocksAlgorithms[i];
+      }
+    }
+  };
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+  if (!m_numaArenas.empty()) {
+    // each node processes a contiguous block of events proportional to its
+    // number of threads, so that the threads only touch node-local replicas
+    int totalConcurrency = 0;
+    for (const auto& arena : m_numaArenas) {
+      totalConcurrency += arena->max_concurrency();
+    }
+    std::vector<tbb::task_group> groups(m_numaArenas.size());
+    std::size_t begin = eventsRange.first;
+    int concurrency = 0;
+    for (std::size_t node = 0; node < m_numaArenas.size(); ++node) {
+      concurrency += m_numaArenas[node]->max_concurrency();
+      std::size_t end = eventsRange.first +
+                        nTotalEvents * concurrency / totalConcurrency;
+      ACTS_DEBUG("Process events [" << begin << ", " << end
+                                    << ") on NUMA node " << node);
+      m_numaArenas[node]->execute([&, node, begin, end] {
+        groups[node].run([&, begin, end] {
+          tbb::parallel_for(tbb::blocked_range<std::size_t>(begin, end),
+                            processEvents);
+        });
+      });
+      begin = end;
+    }
+    for (std::size_t node = 0; node < m_numaArenas.size(); ++node) {
+      m_numaArenas[node]->execute([&, node] { groups[node].wait(); });
+    }
+  } else
+#endif
+  {
+    m_taskArena.execute([&] {
+      tbbWrap::parallel_for(
+          tbb::blocked_range<std::size_t>(eventsRange.first,
+                                          eventsRange.second),
+          processEvents);
+    });
+  }
+}
+
+void Sequencer::runWorkerProcesses(
+    std::pair<std::size_t, std::size_t> eventsRange,
+    std::vector<Duration>& clocksAlgorithms) {
+  struct Worker {
+    pid_t pid;
+    int fd;
+  };
+  std::vector<Worker> workers;
+
+  // threads do not survive the fork, their locks and work would be lost
+  std::size_t nThreads = numProcessThreads();
+  if (nThreads > 1) {
+    ACTS_FATAL("Can not fork worker processes with "
+               << nThreads
+               << " threads running, e.g. TBB workers started by an earlier "
+                  "run in the same process");
+    throw std::runtime_error("Threads running before forking worker processes");
+  }
+
+  // the worker processes should not repeat buffered output
+  std::cout.flush();
+  std::fflush(nullptr);
+
+  std::size_t nTotalEvents = eventsRange.second - eventsRange.first;
+  for (std::size_t worker = 0; worker < m_cfg.numProcesses; ++worker) {
+    std::pair<std::size_t, std::size_t> workerRange{
+        eventsRange.first + nTotalEvents * worker / m_cfg.numProcesses,
+        eventsRange.first + nTotalEvents * (worker + 1) / m_cfg.numProcesses};
+
+    int fds[2];
+    if (pipe(fds) != 0) {
+      throw std::runtime_error("Failed to create pipe for worker process");
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+      throw std::runtime_error("Failed to fork worker process");
+    }
+
+    if (pid == 0) {
+      close(fds[0]);
+      for (const Worker& other : workers) {
+        close(other.fd);
+      }
+
+      int code = EXIT_FAILURE;
+      try {
+        for (auto& [alg, fpe] : m_sequenceElements) {
+          auto writer = std::dynamic_pointer_cast<IWriter>(alg);
+          if (writer != nullptr &&
+              writer->shardOutput(worker) != ProcessCode::SUCCESS) {
+            throw std::runtime_error("Writer " + writer->name() +
+                                     " does not support worker processes");
+          }
+        }
+        std::vector<Duration> workerClocks(clocksAlgorithms.size(),
+                                           Duration::zero());
+        runEventLoop(workerRange, workerClocks);
+        finalizeElements();
+        fpeReport();
+
+        // report back to the parent process
+        std::vector<Duration::rep> summary;
+        summary.push_back(m_nUnmaskedFpe);
+        for (const Duration& clock : workerClocks) {
+          summary.push_back(clock.count());
+        }
+        if (writeAll(fds[1], summary.data(),
+                     summary.size() * sizeof(Duration::rep))) {
+          code = EXIT_SUCCESS;
+        }
+      } catch (const std::exception& e) {
+        ACTS_FATAL("Worker process " << worker << " failed: " << e.what());
+      }
+      close(fds[1]);
+      std::cout.flush();
+      std::fflush(nullptr);
+      // leave without returning to the caller of `run()`
+      std::_Exit(code);
+    }
+
+    close(fds[1]);
+    workers.push_back({pid, fds[0]});
+    ACTS_INFO("Started worker process " << pid << " for events ["
+                                        << workerRange.first << ", "
+                                        << workerRange.second << ")");
+  }
+
+  std::size_t nFailed = 0;
+  for (const Worker& worker : workers) {
+    std::vector<Duration::rep> summary(1 + clocksAlgorithms.size());
+    bool received = readAll(worker.fd, summary.data(),
+                            summary.size() * sizeof(Duration::rep));
+    close(worker.fd);
+
+    int status = 0;
+    waitpid(worker.pid, &status, 0);
+    if (!received || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != EXIT_SUCCESS) {
+      ACTS_ERROR("Worker process " << worker.pid << " failed");
+      nFailed++;
+      continue;
+    }
+
+    m_nUnmaskedFpe += summary[0];
+    for (std::size_t i = 0; i < clocksAlgorithms.size(); ++i) {
+      clocksAlgorithms[i] += Duration(summary[i + 1]);
+    }
+  }
+
+  if (nFailed > 0) {
+    throw std::runtime_error(std::to_string(nFailed) +
+                             " worker processes failed");
+  }
+}
+
+void Sequencer::finalizeElements() {
+  ACTS_VERBOSE("Finalize sequence elements");
+  for (auto& [alg, fpe] : m_sequenceElements) {
+    ACTS_VERBOSE("Finalize " << getAlgorithmType(*alg) << ": " << alg->name());
+    if (alg->finalize() != ProcessCode::SUCCESS) {
+      ACTS_FATAL("Failed to finalize " << getAlgorithmType(*alg) << ": "
+                                       << alg->name());
+      throw std::runtime_error("Failed to process event data");
+    }
+  }
+}
+
 void Sequencer::fpeReport() const {
   if (!m_cfg.trackFpes) {
     return;
@@ -0,0 +1,21 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Utilities/Numa.hpp"
+
+namespace {
+thread_local std::size_t s_currentNumaNode = 0;
+}  // namespace
+
+std::size_t ActsExamples::currentNumaNode() {
+  return s_currentNumaNode;
+}
+
+void ActsExamples::detail::setCurrentNumaNode(std::size_t node) {
+  s_currentNumaNode = node;
+}
@@ -31,7 +31,7 @@ struct GraphData {
 ActsExamples::CsvExaTrkXGraphWriter::CsvExaTrkXGraphWriter(
     const ActsExamples::CsvExaTrkXGraphWriter::Config& config,
     Acts::Logging::Level level)
-    : WriterT(config.inputGraph, "CsvExaTrkXGraphWriter", level),
+    : WriterT(config.inputGraph, "CsvExaTrkXGraphWriter", level, true),
       m_cfg(config) {}
 
 ActsExamples::ProcessCode ActsExamples::CsvExaTrkXGraphWriter::writeT(
@@ -33,7 +33,7 @@
 ActsExamples::CsvMeasurementWriter::CsvMeasurementWriter(
     const ActsExamples::CsvMeasurementWriter::Config& config,
     Acts::Logging::Level level)
-    : WriterT(config.inputMeasurements, "CsvMeasurementWriter", level),
+    : WriterT(config.inputMeasurements, "CsvMeasurementWriter", level, true),
       m_cfg(config) {
   // Input container for measurements is already checked by base constructor
   if (m_cfg.inputMeasurementSimHitsMap.empty()) {
@@ -24,7 +24,7 @@
 ActsExamples::CsvParticleWriter::CsvParticleWriter(
     const ActsExamples::CsvParticleWriter::Config& cfg,
     Acts::Logging::Level lvl)
-    : WriterT(cfg.inputParticles, "CsvParticleWriter", lvl), m_cfg(cfg) {
+    : WriterT(cfg.inputParticles, "CsvParticleWriter", lvl, true), m_cfg(cfg) {
   // inputParticles is already checked by base constructor
   if (m_cfg.outputStem.empty()) {
     throw std::invalid_argument("Missing output filename stem");
@@ -36,7 +36,7 @@
 ActsExamples::CsvPlanarClusterWriter::CsvPlanarClusterWriter(
     const ActsExamples::CsvPlanarClusterWriter::Config& config,
     Acts::Logging::Level level)
-    : WriterT(config.inputClusters, "CsvPlanarClusterWriter", level),
+    : WriterT(config.inputClusters, "CsvPlanarClusterWriter", level, true),
       m_cfg(config) {
   // inputClusters is already checked by base constructor
   if (m_cfg.inputSimHits.empty()) {
@@ -29,7 +29,7 @@
 ActsExamples::CsvProtoTrackWriter::CsvProtoTrackWriter(
     const ActsExamples::CsvProtoTrackWriter::Config& config,
     Acts::Logging::Level level)
-    : WriterT(config.inputPrototracks, "CsvProtoTrackWriter", level),
+    : WriterT(config.inputPrototracks, "CsvProtoTrackWriter", level, true),
       m_cfg(config) {
   m_inputSpacepoints.initialize(m_cfg.inputSpacepoints);
 }
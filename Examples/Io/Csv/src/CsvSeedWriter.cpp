@@ -37,7 +37,7 @@ ActsExamples::CsvSeedWriter::CsvSeedWriter(
     const ActsExamples::CsvSeedWriter::Config& config,
     Acts::Logging::Level level)
     : WriterT<TrackParametersContainer>(config.inputTrackParameters,
-                                        "CsvSeedWriter", level),
+                                        "CsvSeedWriter", level, true),
       m_cfg(config) {
   if (m_cfg.inputSimSeeds.empty()) {
     throw std::invalid_argument("Missing space points input collection");
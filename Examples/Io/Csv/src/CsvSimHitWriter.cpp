@@ -28,7 +28,8 @@
 ActsExamples::CsvSimHitWriter::CsvSimHitWriter(
     const ActsExamples::CsvSimHitWriter::Config& config,
     Acts::Logging::Level level)
-    : WriterT(config.inputSimHits, "CsvSimHitWriter", level), m_cfg(config) {
+    : WriterT(config.inputSimHits, "CsvSimHitWriter", level, true),
+      m_cfg(config) {
   // inputSimHits is already checked by base constructor
   if (m_cfg.outputStem.empty()) {
     throw std::invalid_argument("Missing output filename stem");
@@ -28,7 +28,7 @@
 ActsExamples::CsvSpacepointWriter::CsvSpacepointWriter(
     const ActsExamples::CsvSpacepointWriter::Config& config,
     Acts::Logging::Level level)
-    : WriterT(config.inputSpacepoints, "CsvSpacepointWriter", level),
+    : WriterT(config.inputSpacepoints, "CsvSpacepointWriter", level, true),
       m_cfg(config) {}
 
 ActsExamples::CsvSpacepointWriter::~CsvSpacepointWriter() = default;
@@ -24,7 +24,8 @@
 ActsExamples::CsvTrackParameterWriter::CsvTrackParameterWriter(
     const ActsExamples::CsvTrackParameterWriter::Config& config,
     Acts::Logging::Level level)
-    : m_cfg(config),
+    : IWriter(true),
+      m_cfg(config),
       m_logger(Acts::getDefaultLogger("CsvTrackParameterWriter", level)) {
   if (m_cfg.inputTrackParameters.empty() == m_cfg.inputTracks.empty()) {
     throw std::invalid_argument(
@@ -38,7 +38,8 @@ using namespace ActsExamples;
 
 CsvTrackWriter::CsvTrackWriter(const CsvTrackWriter::Config& config,
                                Acts::Logging::Level level)
-    : WriterT<ConstTrackContainer>(config.inputTracks, "CsvTrackWriter", level),
+    : WriterT<ConstTrackContainer>(config.inputTracks, "CsvTrackWriter",
+                                   level, true),
       m_cfg(config) {
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("Missing input tracks collection");
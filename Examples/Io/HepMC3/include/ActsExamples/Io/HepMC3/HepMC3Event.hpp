@@ -12,6 +12,8 @@
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/EventData/SimVertex.hpp"
 
+#include <cstdint>
+
 #include <HepMC3/FourVector.h>
 #include <HepMC3/GenEvent.h>
 #include <HepMC3/GenParticle.h>
@@ -138,5 +140,13 @@ std::vector<SimParticle> beams(const HepMC3::GenEvent& event);
 /// @return List of final state particles
 std::vector<SimParticle> finalState(const HepMC3::GenEvent& event);
 
+/// @brief Returns the final state particles of an event translated into Acts,
+/// placed at their production vertex
+/// @param event event in HepMC data type, with momenta in GeV and lengths in mm
+/// @param vertexPrimary primary vertex component of the particle identifiers
+/// @return final state particles of the event
+SimParticleContainer finalStateParticles(const HepMC3::GenEvent& event,
+                                         std::uint64_t vertexPrimary = 1u);
+
 }  // namespace HepMC3Event
 }  // namespace ActsExamples
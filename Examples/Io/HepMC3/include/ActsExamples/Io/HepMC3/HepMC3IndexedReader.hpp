@@ -0,0 +1,84 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <HepMC3/GenEvent.h>
+#include <HepMC3/GenRunInfo.h>
+
+namespace ActsExamples {
+struct AlgorithmContext;
+
+/// Random access reader for a single multi-event HepMC3 ASCII file.
+///
+/// The byte offsets of all events in the file are indexed once on
+/// construction. Afterwards, every event is read on demand by its event number
+/// with a `HepMC3::ReaderAscii` on its own stream, positioned at the offset of
+/// the event, i.e. the events of one file are decoded concurrently by the
+/// sequencer threads. The final state particles are converted from the
+/// decoded event.
+class HepMC3IndexedReader final : public IReader {
+ public:
+  struct Config {
+    /// The input file
+    std::string inputPath;
+    /// The output final state particles collection, optional
+    std::string outputParticles;
+    /// The output events collection with one event, optional
+    std::string outputEvents;
+  };
+
+  /// Construct the reader and index the input file.
+  ///
+  /// @param [in] cfg The configuration object
+  /// @param [in] lvl The logging level
+  HepMC3IndexedReader(const Config& cfg, Acts::Logging::Level lvl);
+
+  std::string name() const override;
+
+  /// Return the available events range.
+  std::pair<std::size_t, std::size_t> availableEvents() const override;
+
+  /// Read out data from the input stream.
+  ProcessCode read(const ActsExamples::AlgorithmContext& ctx) override;
+
+  /// Get readonly access to the config parameters
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// The configuration of this reader
+  Config m_cfg;
+  /// The run info of the file header, shared by all events
+  std::shared_ptr<HepMC3::GenRunInfo> m_runInfo;
+  /// Byte offsets of the events
+  std::vector<std::uint64_t> m_offsets;
+  /// The logger
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+
+  WriteDataHandle<SimParticleContainer> m_outputParticles{this,
+                                                          "OutputParticles"};
+  WriteDataHandle<std::vector<HepMC3::GenEvent>> m_outputEvents{this,
+                                                                "OutputEvents"};
+};
+
+}  // namespace ActsExamples
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IReader.hpp"
 
@@ -27,6 +28,8 @@ class HepMC3AsciiReader final : public IReader {
     std::string inputStem;
     // The output collection
     std::string outputEvents;
+    // The output final state particles of all events, optional
+    std::string outputParticles;
   };
 
   /// @brief Reads an event from file
@@ -69,6 +72,8 @@ class HepMC3AsciiReader final : public IReader {
 
   WriteDataHandle<std::vector<HepMC3::GenEvent>> m_outputEvents{this,
                                                                 "OutputEvents"};
+  WriteDataHandle<SimParticleContainer> m_outputParticles{this,
+                                                          "OutputParticles"};
 };
 
 }  // namespace ActsExamples
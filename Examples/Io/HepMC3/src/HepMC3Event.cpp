@@ -10,6 +10,9 @@
 
 #include "ActsExamples/Io/HepMC3/HepMC3Particle.hpp"
 #include "ActsExamples/Io/HepMC3/HepMC3Vertex.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+
+#include <utility>
 
 namespace {
 /// @brief Converts an SimParticle into HepMC3::GenParticle
@@ -301,3 +304,30 @@ std::vector<ActsExamples::SimParticle> ActsExamples::HepMC3Event::finalState(
   }
   return fState;
 }
+
+ActsExamples::SimParticleContainer
+ActsExamples::HepMC3Event::finalStateParticles(const HepMC3::GenEvent& event,
+                                               std::uint64_t vertexPrimary) {
+  SimParticleContainer::sequence_type fState;
+
+  for (const auto& genParticle : event.particles()) {
+    // Collect particles without end vertex, as in finalState
+    if (genParticle->end_vertex()) {
+      continue;
+    }
+    SimParticle particle = HepMC3Particle::particle(genParticle);
+    ActsFatras::Barcode particleId = particle.particleId();
+    particleId.setVertexPrimary(vertexPrimary);
+    particle.setParticleId(particleId);
+    // HepMC3 stores the time as length, as Acts does
+    if (const auto& vertex = genParticle->production_vertex()) {
+      const HepMC3::FourVector& pos = vertex->position();
+      particle.setPosition4(pos.x(), pos.y(), pos.z(), pos.t());
+    }
+    fState.push_back(std::move(particle));
+  }
+
+  SimParticleContainer particles;
+  particles.insert(fState.begin(), fState.end());
+  return particles;
+}
@@ -0,0 +1,120 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/HepMC3/HepMC3IndexedReader.hpp"
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3Event.hpp"
+
+#include <fstream>
+#include <stdexcept>
+
+#include <HepMC3/ReaderAscii.h>
+#include <HepMC3/Units.h>
+
+ActsExamples::HepMC3IndexedReader::HepMC3IndexedReader(
+    const ActsExamples::HepMC3IndexedReader::Config& cfg,
+    Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_logger(Acts::getDefaultLogger("HepMC3IndexedReader", lvl)) {
+  if (m_cfg.inputPath.empty()) {
+    throw std::invalid_argument("Missing input file path");
+  }
+  if (m_cfg.outputParticles.empty() && m_cfg.outputEvents.empty()) {
+    throw std::invalid_argument("Missing output collection");
+  }
+
+  std::ifstream file(m_cfg.inputPath, std::ios::binary);
+  if (!file) {
+    throw std::invalid_argument("Could not open input file '" +
+                                m_cfg.inputPath + "'");
+  }
+
+  // index the event records
+  std::uint64_t offset = 0;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.rfind("E ", 0) == 0) {
+      m_offsets.push_back(offset);
+    } else if (line.rfind("HepMC::Asciiv3-END_EVENT_LISTING", 0) == 0) {
+      break;
+    }
+    // the last line might not be terminated
+    offset += line.size() + (file.eof() ? 0u : 1u);
+  }
+  if (m_offsets.empty()) {
+    throw std::invalid_argument("No events in input file '" +
+                                m_cfg.inputPath + "'");
+  }
+
+  // the run info is only parsed from the header, i.e. when reading the first
+  // event from the start of the file
+  HepMC3::ReaderAscii reader(m_cfg.inputPath);
+  HepMC3::GenEvent event;
+  if (!reader.read_event(event)) {
+    throw std::invalid_argument("Could not read the first event of '" +
+                                m_cfg.inputPath + "'");
+  }
+  m_runInfo = reader.run_info();
+  reader.close();
+
+  ACTS_DEBUG("Indexed " << m_offsets.size() << " events in "
+                        << m_cfg.inputPath);
+
+  m_outputParticles.maybeInitialize(m_cfg.outputParticles);
+  m_outputEvents.maybeInitialize(m_cfg.outputEvents);
+}
+
+std::string ActsExamples::HepMC3IndexedReader::name() const {
+  return "HepMC3IndexedReader";
+}
+
+std::pair<std::size_t, std::size_t>
+ActsExamples::HepMC3IndexedReader::availableEvents() const {
+  return {0u, m_offsets.size()};
+}
+
+ActsExamples::ProcessCode ActsExamples::HepMC3IndexedReader::read(
+    const ActsExamples::AlgorithmContext& ctx) {
+  if (ctx.eventNumber >= m_offsets.size()) {
+    ACTS_ERROR("Event " << ctx.eventNumber << " is not available in "
+                        << m_cfg.inputPath);
+    return ProcessCode::ABORT;
+  }
+
+  ACTS_DEBUG("Reading event " << ctx.eventNumber << " at offset "
+                              << m_offsets[ctx.eventNumber]);
+  // every call uses its own stream to allow concurrent reads, the reader
+  // stops in front of the next event
+  std::ifstream file(m_cfg.inputPath, std::ios::binary);
+  file.seekg(m_offsets[ctx.eventNumber]);
+  HepMC3::ReaderAscii reader(file);
+  HepMC3::GenEvent event(HepMC3::Units::GEV, HepMC3::Units::MM);
+  if (!file || !reader.read_event(event)) {
+    ACTS_ERROR("Could not read event " << ctx.eventNumber << " from "
+                                       << m_cfg.inputPath);
+    return ProcessCode::ABORT;
+  }
+  event.set_run_info(m_runInfo);
+  // the event has the units of the file
+  event.set_units(HepMC3::Units::GEV, HepMC3::Units::MM);
+
+  if (!m_cfg.outputParticles.empty()) {
+    auto particles = HepMC3Event::finalStateParticles(event);
+    ACTS_VERBOSE("Converted " << particles.size() << " final state particles");
+    m_outputParticles(ctx, std::move(particles));
+  }
+
+  if (!m_cfg.outputEvents.empty()) {
+    std::vector<HepMC3::GenEvent> events;
+    events.push_back(std::move(event));
+    m_outputEvents(ctx, std::move(events));
+  }
+
+  return ProcessCode::SUCCESS;
+}
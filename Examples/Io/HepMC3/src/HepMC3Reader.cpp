@@ -9,8 +9,12 @@
 #include "ActsExamples/Io/HepMC3/HepMC3Reader.hpp"
 
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3Event.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <cstddef>
+#include <utility>
+
 #include <HepMC3/Units.h>
 
 bool ActsExamples::HepMC3AsciiReader::readEvent(HepMC3::ReaderAscii& reader,
@@ -38,6 +42,7 @@ ActsExamples::HepMC3AsciiReader::HepMC3AsciiReader(
   }
 
   m_outputEvents.initialize(m_cfg.outputEvents);
+  m_outputParticles.maybeInitialize(m_cfg.outputParticles);
 }
 
 std::string ActsExamples::HepMC3AsciiReader::HepMC3AsciiReader::name() const {
@@ -71,6 +76,17 @@ ActsExamples::ProcessCode ActsExamples::HepMC3AsciiReader::read(
     return ActsExamples::ProcessCode::ABORT;
   }
 
+  if (!m_cfg.outputParticles.empty()) {
+    // the particles of every event get their own primary vertex
+    SimParticleContainer particles;
+    for (std::size_t i = 0; i < events.size(); ++i) {
+      events[i].set_units(HepMC3::Units::GEV, HepMC3::Units::MM);
+      auto eventParticles = HepMC3Event::finalStateParticles(events[i], i + 1);
+      particles.insert(eventParticles.begin(), eventParticles.end());
+    }
+    m_outputParticles(ctx, std::move(particles));
+  }
+
   ACTS_VERBOSE(events.size()
                << " events read, writing to " << m_cfg.outputEvents);
   m_outputEvents(ctx, std::move(events));
@@ -39,9 +39,12 @@ void ActsExamples::ObjTrackingGeometryWriter::write(
   ACTS_DEBUG(">>Obj: Writer for TrackingVolume object called.");
 
   Acts::ObjVisualization3D objVis(m_cfg.outputPrecision, m_cfg.outputScalor);
+  // shared by all volumes and layers, the sensitive surfaces are written in
+  // chunks by the drawing methods
+  Acts::GeometryView3D::TessellationCache cache;
 
   Acts::GeometryView3D::drawTrackingVolume(
       objVis, tVolume, context.geoContext, m_cfg.containerView,
       m_cfg.volumeView, m_cfg.passiveView, m_cfg.sensitiveView, m_cfg.gridView,
-      true, "", m_cfg.outputDir);
+      true, "", m_cfg.outputDir, &cache);
 }
@@ -83,6 +83,9 @@ class RootMaterialTrackWriter
   /// Framework initialize method
   ActsExamples::ProcessCode finalize() override;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Readonly access to the config
   const Config& config() const { return m_cfg; }
 
@@ -27,6 +27,7 @@
 #include "ActsFatras/Digitization/Channelizer.hpp"
 
 #include <array>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -268,6 +269,9 @@ class RootMeasurementWriter final : public WriterT<MeasurementContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Get const access to the config
   const Config& config() const { return m_cfg; }
 
@@ -14,6 +14,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
@@ -63,6 +64,9 @@ class RootParticleWriter final : public WriterT<SimParticleContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -17,6 +17,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -70,6 +71,9 @@ class RootPlanarClusterWriter
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -61,6 +61,9 @@ class RootPropagationStepsWriter
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
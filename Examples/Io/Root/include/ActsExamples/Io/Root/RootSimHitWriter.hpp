@@ -13,6 +13,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
@@ -56,6 +57,9 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
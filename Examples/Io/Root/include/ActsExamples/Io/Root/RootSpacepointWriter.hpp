@@ -13,6 +13,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <mutex>
@@ -57,6 +58,9 @@ class RootSpacepointWriter final : public WriterT<SimSpacePointContainer> {
   /// End-of-run hook
   ProcessCode finalize() final;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
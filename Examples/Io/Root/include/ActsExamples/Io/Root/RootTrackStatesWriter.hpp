@@ -20,7 +20,9 @@
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -33,6 +35,9 @@ class Barcode;
 
 namespace ActsExamples {
 struct AlgorithmContext;
+namespace detail {
+class RNTupleOutput;
+}  // namespace detail
 
 /// @class RootTrackStatesWriter
 ///
@@ -69,6 +74,9 @@ class RootTrackStatesWriter final : public WriterT<ConstTrackContainer> {
     std::string treeName = "trackstates";
     /// file access mode.
     std::string fileMode = "RECREATE";
+    /// write an RNTuple with the same columns instead of a TTree, requires
+    /// ROOT 6.28 or newer.
+    bool writeRNTuple = false;
   };
 
   /// Constructor
@@ -82,6 +90,9 @@ class RootTrackStatesWriter final : public WriterT<ConstTrackContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -111,6 +122,8 @@ class RootTrackStatesWriter final : public WriterT<ConstTrackContainer> {
   TFile* m_outputFile{nullptr};
   /// The output tree
   TTree* m_outputTree{nullptr};
+  /// The output RNTuple, replaces the tree
+  std::unique_ptr<detail::RNTupleOutput> m_outputNTuple;
   /// the event number
   uint32_t m_eventNr{0};
   /// the track number
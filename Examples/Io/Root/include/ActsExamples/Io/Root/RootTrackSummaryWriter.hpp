@@ -17,7 +17,9 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -32,6 +34,9 @@ class Barcode;
 
 namespace ActsExamples {
 struct AlgorithmContext;
+namespace detail {
+class RNTupleOutput;
+}  // namespace detail
 
 /// @class RootTrackSummaryWriter
 ///
@@ -65,6 +70,9 @@ class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
     std::string treeName = "tracksummary";
     /// File access mode.
     std::string fileMode = "RECREATE";
+    /// Write an RNTuple with the same columns instead of a TTree, requires
+    /// ROOT 6.28 or newer.
+    bool writeRNTuple = false;
     /// Switch for adding full covariance matrix to output file.
     bool writeCovMat = false;
     /// Write GSF specific things (for now only some material statistics)
@@ -83,6 +91,9 @@ class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Continue in the output file `<stem>_worker<i>.root` of a worker process
+  ProcessCode shardOutput(std::size_t worker) override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -103,6 +114,8 @@ class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
   std::mutex m_writeMutex;  ///< Mutex used to protect multi-threaded writes
   TFile* m_outputFile{nullptr};     ///< The output file
   TTree* m_outputTree{nullptr};     ///< The output tree
+  std::unique_ptr<detail::RNTupleOutput>
+      m_outputNTuple;  ///< The output RNTuple, replaces the tree
   uint32_t m_eventNr{0};            ///< The event number
   std::vector<uint32_t> m_trackNr;  ///< The track number in event
 
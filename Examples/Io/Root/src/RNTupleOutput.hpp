@@ -0,0 +1,121 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <TFile.h>
+
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6, 31, 0)
+#include <ROOT/RNTupleWriter.hxx>
+#else
+#include <ROOT/RNTuple.hxx>
+#endif
+#include <ROOT/RNTupleModel.hxx>
+#endif
+
+namespace ActsExamples::detail {
+
+/// Columnar RNTuple output with the same columns as a writer's TTree.
+///
+/// Every column is bound to the member the writer fills for its TTree
+/// branch. On fill, the member content is swapped into the RNTuple entry and
+/// back afterwards, so the writers prepare their data the same way for both
+/// formats and nothing is copied. The pages are compressed in parallel if
+/// ROOT's implicit multi-threading is enabled.
+class RNTupleOutput {
+ public:
+  /// @param file is the output file, needs to outlive the output
+  /// @param name is the name of the RNTuple
+  RNTupleOutput(TFile& file, std::string name)
+      : m_file(&file), m_name(std::move(name)) {
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+    m_model = ROOT::Experimental::RNTupleModel::Create();
+#else
+    throw std::invalid_argument("RNTuple output requires ROOT 6.28 or newer");
+#endif
+  }
+
+  /// Add a column bound to a member of the writer.
+  ///
+  /// @param name is the column name
+  /// @param column is the member holding the value of the current entry
+  template <typename T>
+  void addColumn(const std::string& name, T& column) {
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+    auto value = m_model->MakeField<T>(name);
+    m_swaps.push_back([value, &column]() { std::swap(*value, column); });
+#else
+    static_cast<void>(name);
+    static_cast<void>(column);
+#endif
+  }
+
+  /// Continue the output in another file, e.g. of a worker process.
+  ///
+  /// @param file is the new output file, needs to outlive the output
+  void moveTo(TFile& file) {
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+    if (m_writer) {
+      throw std::logic_error("RNTuple output can not move after filling");
+    }
+#endif
+    m_file = &file;
+  }
+
+  /// Fill one entry from the bound members.
+  void fill() {
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+    open();
+    for (const auto& swap : m_swaps) {
+      swap();
+    }
+    m_writer->Fill();
+    for (const auto& swap : m_swaps) {
+      swap();
+    }
+#endif
+  }
+
+  /// Commit the RNTuple to the file.
+  void write() {
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+    open();
+    m_writer.reset();
+#endif
+  }
+
+ private:
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+  /// The model is frozen when the writer is created, i.e. after all columns
+  /// are added.
+  void open() {
+    if (m_model) {
+      m_writer = ROOT::Experimental::RNTupleWriter::Append(std::move(m_model),
+                                                           m_name, *m_file);
+    }
+  }
+
+  std::unique_ptr<ROOT::Experimental::RNTupleModel> m_model;
+  std::unique_ptr<ROOT::Experimental::RNTupleWriter> m_writer;
+#endif
+
+  TFile* m_file;
+  std::string m_name;
+  std::vector<std::function<void()>> m_swaps;
+};
+
+}  // namespace ActsExamples::detail
@@ -31,6 +31,8 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "WorkerOutput.hpp"
+
 using Acts::VectorHelpers::eta;
 using Acts::VectorHelpers::perp;
 using Acts::VectorHelpers::phi;
@@ -114,6 +116,14 @@ ActsExamples::RootMaterialTrackWriter::~RootMaterialTrackWriter() {
   }
 }
 
+ActsExamples::ProcessCode ActsExamples::RootMaterialTrackWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootMaterialTrackWriter::finalize() {
   // write the tree and close the file
   ACTS_INFO("Writing ROOT output File : " << m_cfg.filePath);
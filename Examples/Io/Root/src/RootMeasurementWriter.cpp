@@ -23,6 +23,8 @@
 
 #include <TFile.h>
 
+#include "WorkerOutput.hpp"
+
 namespace Acts {
 class Surface;
 }  // namespace Acts
@@ -89,6 +91,14 @@ ActsExamples::RootMeasurementWriter::~RootMeasurementWriter() {
   }
 }
 
+ActsExamples::ProcessCode ActsExamples::RootMeasurementWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootMeasurementWriter::finalize() {
   /// Close the file if it's yours
   m_outputFile->cd();
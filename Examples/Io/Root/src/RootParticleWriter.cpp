@@ -26,6 +26,8 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "WorkerOutput.hpp"
+
 ActsExamples::RootParticleWriter::RootParticleWriter(
     const ActsExamples::RootParticleWriter::Config& cfg,
     Acts::Logging::Level lvl)
@@ -92,6 +94,14 @@ ActsExamples::RootParticleWriter::~RootParticleWriter() {
   }
 }
 
+ActsExamples::ProcessCode ActsExamples::RootParticleWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootParticleWriter::finalize() {
   m_outputFile->cd();
   m_outputTree->Write();
@@ -37,6 +37,8 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "WorkerOutput.hpp"
+
 ActsExamples::RootPlanarClusterWriter::RootPlanarClusterWriter(
     const ActsExamples::RootPlanarClusterWriter::Config& config,
     Acts::Logging::Level level)
@@ -99,6 +101,14 @@ ActsExamples::RootPlanarClusterWriter::~RootPlanarClusterWriter() {
   }
 }
 
+ActsExamples::ProcessCode ActsExamples::RootPlanarClusterWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootPlanarClusterWriter::finalize() {
   // Write the tree
   m_outputFile->cd();
@@ -25,6 +25,8 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "WorkerOutput.hpp"
+
 ActsExamples::RootPropagationStepsWriter::RootPropagationStepsWriter(
     const ActsExamples::RootPropagationStepsWriter::Config& cfg,
     Acts::Logging::Level level)
@@ -81,6 +83,18 @@ ActsExamples::RootPropagationStepsWriter::~RootPropagationStepsWriter() {
   }
 }
 
+ActsExamples::ProcessCode ActsExamples::RootPropagationStepsWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  // a common file is shared with other writers
+  if (m_cfg.rootFile != nullptr) {
+    return ProcessCode::ABORT;
+  }
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootPropagationStepsWriter::finalize() {
   // Write the tree
   m_outputFile->cd();
@@ -21,6 +21,8 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "WorkerOutput.hpp"
+
 ActsExamples::RootSimHitWriter::RootSimHitWriter(
     const ActsExamples::RootSimHitWriter::Config& config,
     Acts::Logging::Level level)
@@ -74,6 +76,14 @@ ActsExamples::RootSimHitWriter::~RootSimHitWriter() {
   }
 }
 
+ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::finalize() {
   m_outputFile->cd();
   m_outputTree->Write();
@@ -22,6 +22,8 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "WorkerOutput.hpp"
+
 ActsExamples::RootSpacepointWriter::RootSpacepointWriter(
     const ActsExamples::RootSpacepointWriter::Config& config,
     Acts::Logging::Level level)
@@ -63,6 +65,14 @@ ActsExamples::RootSpacepointWriter::~RootSpacepointWriter() {
   }
 }
 
+ActsExamples::ProcessCode ActsExamples::RootSpacepointWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootSpacepointWriter::finalize() {
   m_outputFile->cd();
   m_outputTree->Write();
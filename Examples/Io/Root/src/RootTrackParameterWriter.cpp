@@ -32,6 +32,8 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "WorkerOutput.hpp"
+
 using Acts::VectorHelpers::eta;
 using Acts::VectorHelpers::phi;
 using Acts::VectorHelpers::theta;
@@ -113,6 +115,14 @@ ActsExamples::RootTrackParameterWriter::~RootTrackParameterWriter() {
   }
 }
 
+ActsExamples::ProcessCode ActsExamples::RootTrackParameterWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootTrackParameterWriter::finalize() {
   m_outputFile->cd();
   m_outputTree->Write();
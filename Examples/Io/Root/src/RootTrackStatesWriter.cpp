@@ -40,6 +40,9 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "RNTupleOutput.hpp"
+#include "WorkerOutput.hpp"
+
 namespace ActsExamples {
 class IndexSourceLink;
 }  // namespace ActsExamples
@@ -87,198 +90,227 @@ ActsExamples::RootTrackStatesWriter::RootTrackStatesWriter(
     throw std::ios_base::failure("Could not open '" + path + "'");
   }
   m_outputFile->cd();
-  m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
-  if (m_outputTree == nullptr) {
-    throw std::bad_alloc();
+  if (m_cfg.writeRNTuple) {
+    m_outputNTuple =
+        std::make_unique<detail::RNTupleOutput>(*m_outputFile, m_cfg.treeName);
   } else {
-    // I/O parameters
-    m_outputTree->Branch("event_nr", &m_eventNr);
-    m_outputTree->Branch("track_nr", &m_trackNr);
-
-    m_outputTree->Branch("t_x", &m_t_x);
-    m_outputTree->Branch("t_y", &m_t_y);
-    m_outputTree->Branch("t_z", &m_t_z);
-    m_outputTree->Branch("t_r", &m_t_r);
-    m_outputTree->Branch("t_dx", &m_t_dx);
-    m_outputTree->Branch("t_dy", &m_t_dy);
-    m_outputTree->Branch("t_dz", &m_t_dz);
-    m_outputTree->Branch("t_eLOC0", &m_t_eLOC0);
-    m_outputTree->Branch("t_eLOC1", &m_t_eLOC1);
-    m_outputTree->Branch("t_ePHI", &m_t_ePHI);
-    m_outputTree->Branch("t_eTHETA", &m_t_eTHETA);
-    m_outputTree->Branch("t_eQOP", &m_t_eQOP);
-    m_outputTree->Branch("t_eT", &m_t_eT);
-
-    m_outputTree->Branch("nStates", &m_nStates);
-    m_outputTree->Branch("nMeasurements", &m_nMeasurements);
-    m_outputTree->Branch("volume_id", &m_volumeID);
-    m_outputTree->Branch("layer_id", &m_layerID);
-    m_outputTree->Branch("module_id", &m_moduleID);
-    m_outputTree->Branch("pathLength", &m_pathLength);
-    m_outputTree->Branch("l_x_hit", &m_lx_hit);
-    m_outputTree->Branch("l_y_hit", &m_ly_hit);
-    m_outputTree->Branch("g_x_hit", &m_x_hit);
-    m_outputTree->Branch("g_y_hit", &m_y_hit);
-    m_outputTree->Branch("g_z_hit", &m_z_hit);
-    m_outputTree->Branch("res_x_hit", &m_res_x_hit);
-    m_outputTree->Branch("res_y_hit", &m_res_y_hit);
-    m_outputTree->Branch("err_x_hit", &m_err_x_hit);
-    m_outputTree->Branch("err_y_hit", &m_err_y_hit);
-    m_outputTree->Branch("pull_x_hit", &m_pull_x_hit);
-    m_outputTree->Branch("pull_y_hit", &m_pull_y_hit);
-    m_outputTree->Branch("dim_hit", &m_dim_hit);
-
-    m_outputTree->Branch("nPredicted", &m_nParams[ePredicted]);
-    m_outputTree->Branch("predicted", &m_hasParams[ePredicted]);
-    m_outputTree->Branch("eLOC0_prt", &m_eLOC0[ePredicted]);
-    m_outputTree->Branch("eLOC1_prt", &m_eLOC1[ePredicted]);
-    m_outputTree->Branch("ePHI_prt", &m_ePHI[ePredicted]);
-    m_outputTree->Branch("eTHETA_prt", &m_eTHETA[ePredicted]);
-    m_outputTree->Branch("eQOP_prt", &m_eQOP[ePredicted]);
-    m_outputTree->Branch("eT_prt", &m_eT[ePredicted]);
-    m_outputTree->Branch("res_eLOC0_prt", &m_res_eLOC0[ePredicted]);
-    m_outputTree->Branch("res_eLOC1_prt", &m_res_eLOC1[ePredicted]);
-    m_outputTree->Branch("res_ePHI_prt", &m_res_ePHI[ePredicted]);
-    m_outputTree->Branch("res_eTHETA_prt", &m_res_eTHETA[ePredicted]);
-    m_outputTree->Branch("res_eQOP_prt", &m_res_eQOP[ePredicted]);
-    m_outputTree->Branch("res_eT_prt", &m_res_eT[ePredicted]);
-    m_outputTree->Branch("err_eLOC0_prt", &m_err_eLOC0[ePredicted]);
-    m_outputTree->Branch("err_eLOC1_prt", &m_err_eLOC1[ePredicted]);
-    m_outputTree->Branch("err_ePHI_prt", &m_err_ePHI[ePredicted]);
-    m_outputTree->Branch("err_eTHETA_prt", &m_err_eTHETA[ePredicted]);
-    m_outputTree->Branch("err_eQOP_prt", &m_err_eQOP[ePredicted]);
-    m_outputTree->Branch("err_eT_prt", &m_err_eT[ePredicted]);
-    m_outputTree->Branch("pull_eLOC0_prt", &m_pull_eLOC0[ePredicted]);
-    m_outputTree->Branch("pull_eLOC1_prt", &m_pull_eLOC1[ePredicted]);
-    m_outputTree->Branch("pull_ePHI_prt", &m_pull_ePHI[ePredicted]);
-    m_outputTree->Branch("pull_eTHETA_prt", &m_pull_eTHETA[ePredicted]);
-    m_outputTree->Branch("pull_eQOP_prt", &m_pull_eQOP[ePredicted]);
-    m_outputTree->Branch("pull_eT_prt", &m_pull_eT[ePredicted]);
-    m_outputTree->Branch("g_x_prt", &m_x[ePredicted]);
-    m_outputTree->Branch("g_y_prt", &m_y[ePredicted]);
-    m_outputTree->Branch("g_z_prt", &m_z[ePredicted]);
-    m_outputTree->Branch("px_prt", &m_px[ePredicted]);
-    m_outputTree->Branch("py_prt", &m_py[ePredicted]);
-    m_outputTree->Branch("pz_prt", &m_pz[ePredicted]);
-    m_outputTree->Branch("eta_prt", &m_eta[ePredicted]);
-    m_outputTree->Branch("pT_prt", &m_pT[ePredicted]);
-
-    m_outputTree->Branch("nFiltered", &m_nParams[eFiltered]);
-    m_outputTree->Branch("filtered", &m_hasParams[eFiltered]);
-    m_outputTree->Branch("eLOC0_flt", &m_eLOC0[eFiltered]);
-    m_outputTree->Branch("eLOC1_flt", &m_eLOC1[eFiltered]);
-    m_outputTree->Branch("ePHI_flt", &m_ePHI[eFiltered]);
-    m_outputTree->Branch("eTHETA_flt", &m_eTHETA[eFiltered]);
-    m_outputTree->Branch("eQOP_flt", &m_eQOP[eFiltered]);
-    m_outputTree->Branch("eT_flt", &m_eT[eFiltered]);
-    m_outputTree->Branch("res_eLOC0_flt", &m_res_eLOC0[eFiltered]);
-    m_outputTree->Branch("res_eLOC1_flt", &m_res_eLOC1[eFiltered]);
-    m_outputTree->Branch("res_ePHI_flt", &m_res_ePHI[eFiltered]);
-    m_outputTree->Branch("res_eTHETA_flt", &m_res_eTHETA[eFiltered]);
-    m_outputTree->Branch("res_eQOP_flt", &m_res_eQOP[eFiltered]);
-    m_outputTree->Branch("res_eT_flt", &m_res_eT[eFiltered]);
-    m_outputTree->Branch("err_eLOC0_flt", &m_err_eLOC0[eFiltered]);
-    m_outputTree->Branch("err_eLOC1_flt", &m_err_eLOC1[eFiltered]);
-    m_outputTree->Branch("err_ePHI_flt", &m_err_ePHI[eFiltered]);
-    m_outputTree->Branch("err_eTHETA_flt", &m_err_eTHETA[eFiltered]);
-    m_outputTree->Branch("err_eQOP_flt", &m_err_eQOP[eFiltered]);
-    m_outputTree->Branch("err_eT_flt", &m_err_eT[eFiltered]);
-    m_outputTree->Branch("pull_eLOC0_flt", &m_pull_eLOC0[eFiltered]);
-    m_outputTree->Branch("pull_eLOC1_flt", &m_pull_eLOC1[eFiltered]);
-    m_outputTree->Branch("pull_ePHI_flt", &m_pull_ePHI[eFiltered]);
-    m_outputTree->Branch("pull_eTHETA_flt", &m_pull_eTHETA[eFiltered]);
-    m_outputTree->Branch("pull_eQOP_flt", &m_pull_eQOP[eFiltered]);
-    m_outputTree->Branch("pull_eT_flt", &m_pull_eT[eFiltered]);
-    m_outputTree->Branch("g_x_flt", &m_x[eFiltered]);
-    m_outputTree->Branch("g_y_flt", &m_y[eFiltered]);
-    m_outputTree->Branch("g_z_flt", &m_z[eFiltered]);
-    m_outputTree->Branch("px_flt", &m_px[eFiltered]);
-    m_outputTree->Branch("py_flt", &m_py[eFiltered]);
-    m_outputTree->Branch("pz_flt", &m_pz[eFiltered]);
-    m_outputTree->Branch("eta_flt", &m_eta[eFiltered]);
-    m_outputTree->Branch("pT_flt", &m_pT[eFiltered]);
-
-    m_outputTree->Branch("nSmoothed", &m_nParams[eSmoothed]);
-    m_outputTree->Branch("smoothed", &m_hasParams[eSmoothed]);
-    m_outputTree->Branch("eLOC0_smt", &m_eLOC0[eSmoothed]);
-    m_outputTree->Branch("eLOC1_smt", &m_eLOC1[eSmoothed]);
-    m_outputTree->Branch("ePHI_smt", &m_ePHI[eSmoothed]);
-    m_outputTree->Branch("eTHETA_smt", &m_eTHETA[eSmoothed]);
-    m_outputTree->Branch("eQOP_smt", &m_eQOP[eSmoothed]);
-    m_outputTree->Branch("eT_smt", &m_eT[eSmoothed]);
-    m_outputTree->Branch("res_eLOC0_smt", &m_res_eLOC0[eSmoothed]);
-    m_outputTree->Branch("res_eLOC1_smt", &m_res_eLOC1[eSmoothed]);
-    m_outputTree->Branch("res_ePHI_smt", &m_res_ePHI[eSmoothed]);
-    m_outputTree->Branch("res_eTHETA_smt", &m_res_eTHETA[eSmoothed]);
-    m_outputTree->Branch("res_eQOP_smt", &m_res_eQOP[eSmoothed]);
-    m_outputTree->Branch("res_eT_smt", &m_res_eT[eSmoothed]);
-    m_outputTree->Branch("err_eLOC0_smt", &m_err_eLOC0[eSmoothed]);
-    m_outputTree->Branch("err_eLOC1_smt", &m_err_eLOC1[eSmoothed]);
-    m_outputTree->Branch("err_ePHI_smt", &m_err_ePHI[eSmoothed]);
-    m_outputTree->Branch("err_eTHETA_smt", &m_err_eTHETA[eSmoothed]);
-    m_outputTree->Branch("err_eQOP_smt", &m_err_eQOP[eSmoothed]);
-    m_outputTree->Branch("err_eT_smt", &m_err_eT[eSmoothed]);
-    m_outputTree->Branch("pull_eLOC0_smt", &m_pull_eLOC0[eSmoothed]);
-    m_outputTree->Branch("pull_eLOC1_smt", &m_pull_eLOC1[eSmoothed]);
-    m_outputTree->Branch("pull_ePHI_smt", &m_pull_ePHI[eSmoothed]);
-    m_outputTree->Branch("pull_eTHETA_smt", &m_pull_eTHETA[eSmoothed]);
-    m_outputTree->Branch("pull_eQOP_smt", &m_pull_eQOP[eSmoothed]);
-    m_outputTree->Branch("pull_eT_smt", &m_pull_eT[eSmoothed]);
-    m_outputTree->Branch("g_x_smt", &m_x[eSmoothed]);
-    m_outputTree->Branch("g_y_smt", &m_y[eSmoothed]);
-    m_outputTree->Branch("g_z_smt", &m_z[eSmoothed]);
-    m_outputTree->Branch("px_smt", &m_px[eSmoothed]);
-    m_outputTree->Branch("py_smt", &m_py[eSmoothed]);
-    m_outputTree->Branch("pz_smt", &m_pz[eSmoothed]);
-    m_outputTree->Branch("eta_smt", &m_eta[eSmoothed]);
-    m_outputTree->Branch("pT_smt", &m_pT[eSmoothed]);
-
-    m_outputTree->Branch("nUnbiased", &m_nParams[eUnbiased]);
-    m_outputTree->Branch("unbiased", &m_hasParams[eUnbiased]);
-    m_outputTree->Branch("eLOC0_ubs", &m_eLOC0[eUnbiased]);
-    m_outputTree->Branch("eLOC1_ubs", &m_eLOC1[eUnbiased]);
-    m_outputTree->Branch("ePHI_ubs", &m_ePHI[eUnbiased]);
-    m_outputTree->Branch("eTHETA_ubs", &m_eTHETA[eUnbiased]);
-    m_outputTree->Branch("eQOP_ubs", &m_eQOP[eUnbiased]);
-    m_outputTree->Branch("eT_ubs", &m_eT[eUnbiased]);
-    m_outputTree->Branch("res_eLOC0_ubs", &m_res_eLOC0[eUnbiased]);
-    m_outputTree->Branch("res_eLOC1_ubs", &m_res_eLOC1[eUnbiased]);
-    m_outputTree->Branch("res_ePHI_ubs", &m_res_ePHI[eUnbiased]);
-    m_outputTree->Branch("res_eTHETA_ubs", &m_res_eTHETA[eUnbiased]);
-    m_outputTree->Branch("res_eQOP_ubs", &m_res_eQOP[eUnbiased]);
-    m_outputTree->Branch("res_eT_ubs", &m_res_eT[eUnbiased]);
-    m_outputTree->Branch("err_eLOC0_ubs", &m_err_eLOC0[eUnbiased]);
-    m_outputTree->Branch("err_eLOC1_ubs", &m_err_eLOC1[eUnbiased]);
-    m_outputTree->Branch("err_ePHI_ubs", &m_err_ePHI[eUnbiased]);
-    m_outputTree->Branch("err_eTHETA_ubs", &m_err_eTHETA[eUnbiased]);
-    m_outputTree->Branch("err_eQOP_ubs", &m_err_eQOP[eUnbiased]);
-    m_outputTree->Branch("err_eT_ubs", &m_err_eT[eUnbiased]);
-    m_outputTree->Branch("pull_eLOC0_ubs", &m_pull_eLOC0[eUnbiased]);
-    m_outputTree->Branch("pull_eLOC1_ubs", &m_pull_eLOC1[eUnbiased]);
-    m_outputTree->Branch("pull_ePHI_ubs", &m_pull_ePHI[eUnbiased]);
-    m_outputTree->Branch("pull_eTHETA_ubs", &m_pull_eTHETA[eUnbiased]);
-    m_outputTree->Branch("pull_eQOP_ubs", &m_pull_eQOP[eUnbiased]);
-    m_outputTree->Branch("pull_eT_ubs", &m_pull_eT[eUnbiased]);
-    m_outputTree->Branch("g_x_ubs", &m_x[eUnbiased]);
-    m_outputTree->Branch("g_y_ubs", &m_y[eUnbiased]);
-    m_outputTree->Branch("g_z_ubs", &m_z[eUnbiased]);
-    m_outputTree->Branch("px_ubs", &m_px[eUnbiased]);
-    m_outputTree->Branch("py_ubs", &m_py[eUnbiased]);
-    m_outputTree->Branch("pz_ubs", &m_pz[eUnbiased]);
-    m_outputTree->Branch("eta_ubs", &m_eta[eUnbiased]);
-    m_outputTree->Branch("pT_ubs", &m_pT[eUnbiased]);
-
-    m_outputTree->Branch("chi2", &m_chi2);
+    m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
+    if (m_outputTree == nullptr) {
+      throw std::bad_alloc();
+    }
   }
+
+  auto addColumn = [this](const std::string& name, auto& column) {
+    if (m_outputNTuple) {
+      m_outputNTuple->addColumn(name, column);
+    } else {
+      m_outputTree->Branch(name.c_str(), &column);
+    }
+  };
+
+  // I/O parameters
+  addColumn("event_nr", m_eventNr);
+  addColumn("track_nr", m_trackNr);
+
+  addColumn("t_x", m_t_x);
+  addColumn("t_y", m_t_y);
+  addColumn("t_z", m_t_z);
+  addColumn("t_r", m_t_r);
+  addColumn("t_dx", m_t_dx);
+  addColumn("t_dy", m_t_dy);
+  addColumn("t_dz", m_t_dz);
+  addColumn("t_eLOC0", m_t_eLOC0);
+  addColumn("t_eLOC1", m_t_eLOC1);
+  addColumn("t_ePHI", m_t_ePHI);
+  addColumn("t_eTHETA", m_t_eTHETA);
+  addColumn("t_eQOP", m_t_eQOP);
+  addColumn("t_eT", m_t_eT);
+
+  addColumn("nStates", m_nStates);
+  addColumn("nMeasurements", m_nMeasurements);
+  addColumn("volume_id", m_volumeID);
+  addColumn("layer_id", m_layerID);
+  addColumn("module_id", m_moduleID);
+  addColumn("pathLength", m_pathLength);
+  addColumn("l_x_hit", m_lx_hit);
+  addColumn("l_y_hit", m_ly_hit);
+  addColumn("g_x_hit", m_x_hit);
+  addColumn("g_y_hit", m_y_hit);
+  addColumn("g_z_hit", m_z_hit);
+  addColumn("res_x_hit", m_res_x_hit);
+  addColumn("res_y_hit", m_res_y_hit);
+  addColumn("err_x_hit", m_err_x_hit);
+  addColumn("err_y_hit", m_err_y_hit);
+  addColumn("pull_x_hit", m_pull_x_hit);
+  addColumn("pull_y_hit", m_pull_y_hit);
+  addColumn("dim_hit", m_dim_hit);
+
+  addColumn("nPredicted", m_nParams[ePredicted]);
+  addColumn("predicted", m_hasParams[ePredicted]);
+  addColumn("eLOC0_prt", m_eLOC0[ePredicted]);
+  addColumn("eLOC1_prt", m_eLOC1[ePredicted]);
+  addColumn("ePHI_prt", m_ePHI[ePredicted]);
+  addColumn("eTHETA_prt", m_eTHETA[ePredicted]);
+  addColumn("eQOP_prt", m_eQOP[ePredicted]);
+  addColumn("eT_prt", m_eT[ePredicted]);
+  addColumn("res_eLOC0_prt", m_res_eLOC0[ePredicted]);
+  addColumn("res_eLOC1_prt", m_res_eLOC1[ePredicted]);
+  addColumn("res_ePHI_prt", m_res_ePHI[ePredicted]);
+  addColumn("res_eTHETA_prt", m_res_eTHETA[ePredicted]);
+  addColumn("res_eQOP_prt", m_res_eQOP[ePredicted]);
+  addColumn("res_eT_prt", m_res_eT[ePredicted]);
+  addColumn("err_eLOC0_prt", m_err_eLOC0[ePredicted]);
+  addColumn("err_eLOC1_prt", m_err_eLOC1[ePredicted]);
+  addColumn("err_ePHI_prt", m_err_ePHI[ePredicted]);
+  addColumn("err_eTHETA_prt", m_err_eTHETA[ePredicted]);
+  addColumn("err_eQOP_prt", m_err_eQOP[ePredicted]);
+  addColumn("err_eT_prt", m_err_eT[ePredicted]);
+  addColumn("pull_eLOC0_prt", m_pull_eLOC0[ePredicted]);
+  addColumn("pull_eLOC1_prt", m_pull_eLOC1[ePredicted]);
+  addColumn("pull_ePHI_prt", m_pull_ePHI[ePredicted]);
+  addColumn("pull_eTHETA_prt", m_pull_eTHETA[ePredicted]);
+  addColumn("pull_eQOP_prt", m_pull_eQOP[ePredicted]);
+  addColumn("pull_eT_prt", m_pull_eT[ePredicted]);
+  addColumn("g_x_prt", m_x[ePredicted]);
+  addColumn("g_y_prt", m_y[ePredicted]);
+  addColumn("g_z_prt", m_z[ePredicted]);
+  addColumn("px_prt", m_px[ePredicted]);
+  addColumn("py_prt", m_py[ePredicted]);
+  addColumn("pz_prt", m_pz[ePredicted]);
+  addColumn("eta_prt", m_eta[ePredicted]);
+  addColumn("pT_prt", m_pT[ePredicted]);
+
+  addColumn("nFiltered", m_nParams[eFiltered]);
+  addColumn("filtered", m_hasParams[eFiltered]);
+  addColumn("eLOC0_flt", m_eLOC0[eFiltered]);
+  addColumn("eLOC1_flt", m_eLOC1[eFiltered]);
+  addColumn("ePHI_flt", m_ePHI[eFiltered]);
+  addColumn("eTHETA_flt", m_eTHETA[eFiltered]);
+  addColumn("eQOP_flt", m_eQOP[eFiltered]);
+  addColumn("eT_flt", m_eT[eFiltered]);
+  addColumn("res_eLOC0_flt", m_res_eLOC0[eFiltered]);
+  addColumn("res_eLOC1_flt", m_res_eLOC1[eFiltered]);
+  addColumn("res_ePHI_flt", m_res_ePHI[eFiltered]);
+  addColumn("res_eTHETA_flt", m_res_eTHETA[eFiltered]);
+  addColumn("res_eQOP_flt", m_res_eQOP[eFiltered]);
+  addColumn("res_eT_flt", m_res_eT[eFiltered]);
+  addColumn("err_eLOC0_flt", m_err_eLOC0[eFiltered]);
+  addColumn("err_eLOC1_flt", m_err_eLOC1[eFiltered]);
+  addColumn("err_ePHI_flt", m_err_ePHI[eFiltered]);
+  addColumn("err_eTHETA_flt", m_err_eTHETA[eFiltered]);
+  addColumn("err_eQOP_flt", m_err_eQOP[eFiltered]);
+  addColumn("err_eT_flt", m_err_eT[eFiltered]);
+  addColumn("pull_eLOC0_flt", m_pull_eLOC0[eFiltered]);
+  addColumn("pull_eLOC1_flt", m_pull_eLOC1[eFiltered]);
+  addColumn("pull_ePHI_flt", m_pull_ePHI[eFiltered]);
+  addColumn("pull_eTHETA_flt", m_pull_eTHETA[eFiltered]);
+  addColumn("pull_eQOP_flt", m_pull_eQOP[eFiltered]);
+  addColumn("pull_eT_flt", m_pull_eT[eFiltered]);
+  addColumn("g_x_flt", m_x[eFiltered]);
+  addColumn("g_y_flt", m_y[eFiltered]);
+  addColumn("g_z_flt", m_z[eFiltered]);
+  addColumn("px_flt", m_px[eFiltered]);
+  addColumn("py_flt", m_py[eFiltered]);
+  addColumn("pz_flt", m_pz[eFiltered]);
+  addColumn("eta_flt", m_eta[eFiltered]);
+  addColumn("pT_flt", m_pT[eFiltered]);
+
+  addColumn("nSmoothed", m_nParams[eSmoothed]);
+  addColumn("smoothed", m_hasParams[eSmoothed]);
+  addColumn("eLOC0_smt", m_eLOC0[eSmoothed]);
+  addColumn("eLOC1_smt", m_eLOC1[eSmoothed]);
+  addColumn("ePHI_smt", m_ePHI[eSmoothed]);
+  addColumn("eTHETA_smt", m_eTHETA[eSmoothed]);
+  addColumn("eQOP_smt", m_eQOP[eSmoothed]);
+  addColumn("eT_smt", m_eT[eSmoothed]);
+  addColumn("res_eLOC0_smt", m_res_eLOC0[eSmoothed]);
+  addColumn("res_eLOC1_smt", m_res_eLOC1[eSmoothed]);
+  addColumn("res_ePHI_smt", m_res_ePHI[eSmoothed]);
+  addColumn("res_eTHETA_smt", m_res_eTHETA[eSmoothed]);
+  addColumn("res_eQOP_smt", m_res_eQOP[eSmoothed]);
+  addColumn("res_eT_smt", m_res_eT[eSmoothed]);
+  addColumn("err_eLOC0_smt", m_err_eLOC0[eSmoothed]);
+  addColumn("err_eLOC1_smt", m_err_eLOC1[eSmoothed]);
+  addColumn("err_ePHI_smt", m_err_ePHI[eSmoothed]);
+  addColumn("err_eTHETA_smt", m_err_eTHETA[eSmoothed]);
+  addColumn("err_eQOP_smt", m_err_eQOP[eSmoothed]);
+  addColumn("err_eT_smt", m_err_eT[eSmoothed]);
+  addColumn("pull_eLOC0_smt", m_pull_eLOC0[eSmoothed]);
+  addColumn("pull_eLOC1_smt", m_pull_eLOC1[eSmoothed]);
+  addColumn("pull_ePHI_smt", m_pull_ePHI[eSmoothed]);
+  addColumn("pull_eTHETA_smt", m_pull_eTHETA[eSmoothed]);
+  addColumn("pull_eQOP_smt", m_pull_eQOP[eSmoothed]);
+  addColumn("pull_eT_smt", m_pull_eT[eSmoothed]);
+  addColumn("g_x_smt", m_x[eSmoothed]);
+  addColumn("g_y_smt", m_y[eSmoothed]);
+  addColumn("g_z_smt", m_z[eSmoothed]);
+  addColumn("px_smt", m_px[eSmoothed]);
+  addColumn("py_smt", m_py[eSmoothed]);
+  addColumn("pz_smt", m_pz[eSmoothed]);
+  addColumn("eta_smt", m_eta[eSmoothed]);
+  addColumn("pT_smt", m_pT[eSmoothed]);
+
+  addColumn("nUnbiased", m_nParams[eUnbiased]);
+  addColumn("unbiased", m_hasParams[eUnbiased]);
+  addColumn("eLOC0_ubs", m_eLOC0[eUnbiased]);
+  addColumn("eLOC1_ubs", m_eLOC1[eUnbiased]);
+  addColumn("ePHI_ubs", m_ePHI[eUnbiased]);
+  addColumn("eTHETA_ubs", m_eTHETA[eUnbiased]);
+  addColumn("eQOP_ubs", m_eQOP[eUnbiased]);
+  addColumn("eT_ubs", m_eT[eUnbiased]);
+  addColumn("res_eLOC0_ubs", m_res_eLOC0[eUnbiased]);
+  addColumn("res_eLOC1_ubs", m_res_eLOC1[eUnbiased]);
+  addColumn("res_ePHI_ubs", m_res_ePHI[eUnbiased]);
+  addColumn("res_eTHETA_ubs", m_res_eTHETA[eUnbiased]);
+  addColumn("res_eQOP_ubs", m_res_eQOP[eUnbiased]);
+  addColumn("res_eT_ubs", m_res_eT[eUnbiased]);
+  addColumn("err_eLOC0_ubs", m_err_eLOC0[eUnbiased]);
+  addColumn("err_eLOC1_ubs", m_err_eLOC1[eUnbiased]);
+  addColumn("err_ePHI_ubs", m_err_ePHI[eUnbiased]);
+  addColumn("err_eTHETA_ubs", m_err_eTHETA[eUnbiased]);
+  addColumn("err_eQOP_ubs", m_err_eQOP[eUnbiased]);
+  addColumn("err_eT_ubs", m_err_eT[eUnbiased]);
+  addColumn("pull_eLOC0_ubs", m_pull_eLOC0[eUnbiased]);
+  addColumn("pull_eLOC1_ubs", m_pull_eLOC1[eUnbiased]);
+  addColumn("pull_ePHI_ubs", m_pull_ePHI[eUnbiased]);
+  addColumn("pull_eTHETA_ubs", m_pull_eTHETA[eUnbiased]);
+  addColumn("pull_eQOP_ubs", m_pull_eQOP[eUnbiased]);
+  addColumn("pull_eT_ubs", m_pull_eT[eUnbiased]);
+  addColumn("g_x_ubs", m_x[eUnbiased]);
+  addColumn("g_y_ubs", m_y[eUnbiased]);
+  addColumn("g_z_ubs", m_z[eUnbiased]);
+  addColumn("px_ubs", m_px[eUnbiased]);
+  addColumn("py_ubs", m_py[eUnbiased]);
+  addColumn("pz_ubs", m_pz[eUnbiased]);
+  addColumn("eta_ubs", m_eta[eUnbiased]);
+  addColumn("pT_ubs", m_pT[eUnbiased]);
+
+  addColumn("chi2", m_chi2);
 }
 
 ActsExamples::RootTrackStatesWriter::~RootTrackStatesWriter() {
+  m_outputNTuple.reset();
   m_outputFile->Close();
 }
 
+ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  if (m_outputNTuple != nullptr) {
+    m_outputNTuple->moveTo(*m_outputFile);
+  }
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::finalize() {
   m_outputFile->cd();
-  m_outputTree->Write();
+  if (m_outputNTuple) {
+    m_outputNTuple->write();
+  } else {
+    m_outputTree->Write();
+  }
   m_outputFile->Close();
 
   ACTS_INFO("Wrote states of trajectories to tree '"
@@ -646,7 +678,11 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
     }
 
     // fill the variables for one track to tree
-    m_outputTree->Fill();
+    if (m_outputNTuple) {
+      m_outputNTuple->fill();
+    } else {
+      m_outputTree->Fill();
+    }
 
     // now reset
     m_t_x.clear();
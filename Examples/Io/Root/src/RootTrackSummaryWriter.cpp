@@ -39,6 +39,9 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include "RNTupleOutput.hpp"
+#include "WorkerOutput.hpp"
+
 using Acts::VectorHelpers::eta;
 using Acts::VectorHelpers::perp;
 using Acts::VectorHelpers::phi;
@@ -73,136 +76,165 @@ ActsExamples::RootTrackSummaryWriter::RootTrackSummaryWriter(
     throw std::ios_base::failure("Could not open '" + path + "'");
   }
   m_outputFile->cd();
-  m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
-  if (m_outputTree == nullptr) {
-    throw std::bad_alloc();
+  if (m_cfg.writeRNTuple) {
+    m_outputNTuple =
+        std::make_unique<detail::RNTupleOutput>(*m_outputFile, m_cfg.treeName);
   } else {
-    // I/O parameters
-    m_outputTree->Branch("event_nr", &m_eventNr);
-    m_outputTree->Branch("track_nr", &m_trackNr);
-
-    m_outputTree->Branch("nStates", &m_nStates);
-    m_outputTree->Branch("nMeasurements", &m_nMeasurements);
-    m_outputTree->Branch("nOutliers", &m_nOutliers);
-    m_outputTree->Branch("nHoles", &m_nHoles);
-    m_outputTree->Branch("nSharedHits", &m_nSharedHits);
-    m_outputTree->Branch("chi2Sum", &m_chi2Sum);
-    m_outputTree->Branch("NDF", &m_NDF);
-    m_outputTree->Branch("measurementChi2", &m_measurementChi2);
-    m_outputTree->Branch("outlierChi2", &m_outlierChi2);
-    m_outputTree->Branch("measurementVolume", &m_measurementVolume);
-    m_outputTree->Branch("measurementLayer", &m_measurementLayer);
-    m_outputTree->Branch("outlierVolume", &m_outlierVolume);
-    m_outputTree->Branch("outlierLayer", &m_outlierLayer);
-
-    m_outputTree->Branch("nMajorityHits", &m_nMajorityHits);
-    m_outputTree->Branch("majorityParticleId", &m_majorityParticleId);
-    m_outputTree->Branch("t_charge", &m_t_charge);
-    m_outputTree->Branch("t_time", &m_t_time);
-    m_outputTree->Branch("t_vx", &m_t_vx);
-    m_outputTree->Branch("t_vy", &m_t_vy);
-    m_outputTree->Branch("t_vz", &m_t_vz);
-    m_outputTree->Branch("t_px", &m_t_px);
-    m_outputTree->Branch("t_py", &m_t_py);
-    m_outputTree->Branch("t_pz", &m_t_pz);
-    m_outputTree->Branch("t_theta", &m_t_theta);
-    m_outputTree->Branch("t_phi", &m_t_phi);
-    m_outputTree->Branch("t_eta", &m_t_eta);
-    m_outputTree->Branch("t_p", &m_t_p);
-    m_outputTree->Branch("t_pT", &m_t_pT);
-    m_outputTree->Branch("t_d0", &m_t_d0);
-    m_outputTree->Branch("t_z0", &m_t_z0);
-
-    m_outputTree->Branch("hasFittedParams", &m_hasFittedParams);
-    m_outputTree->Branch("eLOC0_fit", &m_eLOC0_fit);
-    m_outputTree->Branch("eLOC1_fit", &m_eLOC1_fit);
-    m_outputTree->Branch("ePHI_fit", &m_ePHI_fit);
-    m_outputTree->Branch("eTHETA_fit", &m_eTHETA_fit);
-    m_outputTree->Branch("eQOP_fit", &m_eQOP_fit);
-    m_outputTree->Branch("eT_fit", &m_eT_fit);
-    m_outputTree->Branch("err_eLOC0_fit", &m_err_eLOC0_fit);
-    m_outputTree->Branch("err_eLOC1_fit", &m_err_eLOC1_fit);
-    m_outputTree->Branch("err_ePHI_fit", &m_err_ePHI_fit);
-    m_outputTree->Branch("err_eTHETA_fit", &m_err_eTHETA_fit);
-    m_outputTree->Branch("err_eQOP_fit", &m_err_eQOP_fit);
-    m_outputTree->Branch("err_eT_fit", &m_err_eT_fit);
-    m_outputTree->Branch("res_eLOC0_fit", &m_res_eLOC0_fit);
-    m_outputTree->Branch("res_eLOC1_fit", &m_res_eLOC1_fit);
-    m_outputTree->Branch("res_ePHI_fit", &m_res_ePHI_fit);
-    m_outputTree->Branch("res_eTHETA_fit", &m_res_eTHETA_fit);
-    m_outputTree->Branch("res_eQOP_fit", &m_res_eQOP_fit);
-    m_outputTree->Branch("res_eT_fit", &m_res_eT_fit);
-    m_outputTree->Branch("pull_eLOC0_fit", &m_pull_eLOC0_fit);
-    m_outputTree->Branch("pull_eLOC1_fit", &m_pull_eLOC1_fit);
-    m_outputTree->Branch("pull_ePHI_fit", &m_pull_ePHI_fit);
-    m_outputTree->Branch("pull_eTHETA_fit", &m_pull_eTHETA_fit);
-    m_outputTree->Branch("pull_eQOP_fit", &m_pull_eQOP_fit);
-    m_outputTree->Branch("pull_eT_fit", &m_pull_eT_fit);
-
-    if (m_cfg.writeGsfSpecific) {
-      m_outputTree->Branch("max_material_fwd", &m_gsf_max_material_fwd);
-      m_outputTree->Branch("sum_material_fwd", &m_gsf_sum_material_fwd);
+    m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
+    if (m_outputTree == nullptr) {
+      throw std::bad_alloc();
     }
+  }
 
-    if (m_cfg.writeCovMat == true) {
-      // create one branch for every entry of covariance matrix
-      // one block for every row of the matrix, every entry gets own branch
-      m_outputTree->Branch("cov_eLOC0_eLOC0", &m_cov_eLOC0_eLOC0);
-      m_outputTree->Branch("cov_eLOC0_eLOC1", &m_cov_eLOC0_eLOC1);
-      m_outputTree->Branch("cov_eLOC0_ePHI", &m_cov_eLOC0_ePHI);
-      m_outputTree->Branch("cov_eLOC0_eTHETA", &m_cov_eLOC0_eTHETA);
-      m_outputTree->Branch("cov_eLOC0_eQOP", &m_cov_eLOC0_eQOP);
-      m_outputTree->Branch("cov_eLOC0_eT", &m_cov_eLOC0_eT);
-
-      m_outputTree->Branch("cov_eLOC1_eLOC0", &m_cov_eLOC1_eLOC0);
-      m_outputTree->Branch("cov_eLOC1_eLOC1", &m_cov_eLOC1_eLOC1);
-      m_outputTree->Branch("cov_eLOC1_ePHI", &m_cov_eLOC1_ePHI);
-      m_outputTree->Branch("cov_eLOC1_eTHETA", &m_cov_eLOC1_eTHETA);
-      m_outputTree->Branch("cov_eLOC1_eQOP", &m_cov_eLOC1_eQOP);
-      m_outputTree->Branch("cov_eLOC1_eT", &m_cov_eLOC1_eT);
-
-      m_outputTree->Branch("cov_ePHI_eLOC0", &m_cov_ePHI_eLOC0);
-      m_outputTree->Branch("cov_ePHI_eLOC1", &m_cov_ePHI_eLOC1);
-      m_outputTree->Branch("cov_ePHI_ePHI", &m_cov_ePHI_ePHI);
-      m_outputTree->Branch("cov_ePHI_eTHETA", &m_cov_ePHI_eTHETA);
-      m_outputTree->Branch("cov_ePHI_eQOP", &m_cov_ePHI_eQOP);
-      m_outputTree->Branch("cov_ePHI_eT", &m_cov_ePHI_eT);
-
-      m_outputTree->Branch("cov_eTHETA_eLOC0", &m_cov_eTHETA_eLOC0);
-      m_outputTree->Branch("cov_eTHETA_eLOC1", &m_cov_eTHETA_eLOC1);
-      m_outputTree->Branch("cov_eTHETA_ePHI", &m_cov_eTHETA_ePHI);
-      m_outputTree->Branch("cov_eTHETA_eTHETA", &m_cov_eTHETA_eTHETA);
-      m_outputTree->Branch("cov_eTHETA_eQOP", &m_cov_eTHETA_eQOP);
-      m_outputTree->Branch("cov_eTHETA_eT", &m_cov_eTHETA_eT);
-
-      m_outputTree->Branch("cov_eQOP_eLOC0", &m_cov_eQOP_eLOC0);
-      m_outputTree->Branch("cov_eQOP_eLOC1", &m_cov_eQOP_eLOC1);
-      m_outputTree->Branch("cov_eQOP_ePHI", &m_cov_eQOP_ePHI);
-      m_outputTree->Branch("cov_eQOP_eTHETA", &m_cov_eQOP_eTHETA);
-      m_outputTree->Branch("cov_eQOP_eQOP", &m_cov_eQOP_eQOP);
-      m_outputTree->Branch("cov_eQOP_eT", &m_cov_eQOP_eT);
-
-      m_outputTree->Branch("cov_eT_eLOC0", &m_cov_eT_eLOC0);
-      m_outputTree->Branch("cov_eT_eLOC1", &m_cov_eT_eLOC1);
-      m_outputTree->Branch("cov_eT_ePHI", &m_cov_eT_ePHI);
-      m_outputTree->Branch("cov_eT_eTHETA", &m_cov_eT_eTHETA);
-      m_outputTree->Branch("cov_eT_eQOP", &m_cov_eT_eQOP);
-      m_outputTree->Branch("cov_eT_eT", &m_cov_eT_eT);
+  auto addColumn = [this](const std::string& name, auto& column) {
+    if (m_outputNTuple) {
+      m_outputNTuple->addColumn(name, column);
+    } else {
+      m_outputTree->Branch(name.c_str(), &column);
     }
+  };
+
+  // I/O parameters
+  addColumn("event_nr", m_eventNr);
+  addColumn("track_nr", m_trackNr);
+
+  addColumn("nStates", m_nStates);
+  addColumn("nMeasurements", m_nMeasurements);
+  addColumn("nOutliers", m_nOutliers);
+  addColumn("nHoles", m_nHoles);
+  addColumn("nSharedHits", m_nSharedHits);
+  addColumn("chi2Sum", m_chi2Sum);
+  addColumn("NDF", m_NDF);
+  addColumn("measurementChi2", m_measurementChi2);
+  addColumn("outlierChi2", m_outlierChi2);
+  addColumn("measurementVolume", m_measurementVolume);
+  addColumn("measurementLayer", m_measurementLayer);
+  addColumn("outlierVolume", m_outlierVolume);
+  addColumn("outlierLayer", m_outlierLayer);
+
+  addColumn("nMajorityHits", m_nMajorityHits);
+  addColumn("majorityParticleId", m_majorityParticleId);
+  addColumn("t_charge", m_t_charge);
+  addColumn("t_time", m_t_time);
+  addColumn("t_vx", m_t_vx);
+  addColumn("t_vy", m_t_vy);
+  addColumn("t_vz", m_t_vz);
+  addColumn("t_px", m_t_px);
+  addColumn("t_py", m_t_py);
+  addColumn("t_pz", m_t_pz);
+  addColumn("t_theta", m_t_theta);
+  addColumn("t_phi", m_t_phi);
+  addColumn("t_eta", m_t_eta);
+  addColumn("t_p", m_t_p);
+  addColumn("t_pT", m_t_pT);
+  addColumn("t_d0", m_t_d0);
+  addColumn("t_z0", m_t_z0);
+
+  addColumn("hasFittedParams", m_hasFittedParams);
+  addColumn("eLOC0_fit", m_eLOC0_fit);
+  addColumn("eLOC1_fit", m_eLOC1_fit);
+  addColumn("ePHI_fit", m_ePHI_fit);
+  addColumn("eTHETA_fit", m_eTHETA_fit);
+  addColumn("eQOP_fit", m_eQOP_fit);
+  addColumn("eT_fit", m_eT_fit);
+  addColumn("err_eLOC0_fit", m_err_eLOC0_fit);
+  addColumn("err_eLOC1_fit", m_err_eLOC1_fit);
+  addColumn("err_ePHI_fit", m_err_ePHI_fit);
+  addColumn("err_eTHETA_fit", m_err_eTHETA_fit);
+  addColumn("err_eQOP_fit", m_err_eQOP_fit);
+  addColumn("err_eT_fit", m_err_eT_fit);
+  addColumn("res_eLOC0_fit", m_res_eLOC0_fit);
+  addColumn("res_eLOC1_fit", m_res_eLOC1_fit);
+  addColumn("res_ePHI_fit", m_res_ePHI_fit);
+  addColumn("res_eTHETA_fit", m_res_eTHETA_fit);
+  addColumn("res_eQOP_fit", m_res_eQOP_fit);
+  addColumn("res_eT_fit", m_res_eT_fit);
+  addColumn("pull_eLOC0_fit", m_pull_eLOC0_fit);
+  addColumn("pull_eLOC1_fit", m_pull_eLOC1_fit);
+  addColumn("pull_ePHI_fit", m_pull_ePHI_fit);
+  addColumn("pull_eTHETA_fit", m_pull_eTHETA_fit);
+  addColumn("pull_eQOP_fit", m_pull_eQOP_fit);
+  addColumn("pull_eT_fit", m_pull_eT_fit);
+
+  if (m_cfg.writeGsfSpecific) {
+    addColumn("max_material_fwd", m_gsf_max_material_fwd);
+    addColumn("sum_material_fwd", m_gsf_sum_material_fwd);
+  }
 
-    if (m_cfg.writeGx2fSpecific) {
-      m_outputTree->Branch("nUpdatesGx2f", &m_nUpdatesGx2f);
-    }
+  if (m_cfg.writeCovMat == true) {
+    // create one branch for every entry of covariance matrix
+    // one block for every row of the matrix, every entry gets own branch
+    addColumn("cov_eLOC0_eLOC0", m_cov_eLOC0_eLOC0);
+    addColumn("cov_eLOC0_eLOC1", m_cov_eLOC0_eLOC1);
+    addColumn("cov_eLOC0_ePHI", m_cov_eLOC0_ePHI);
+    addColumn("cov_eLOC0_eTHETA", m_cov_eLOC0_eTHETA);
+    addColumn("cov_eLOC0_eQOP", m_cov_eLOC0_eQOP);
+    addColumn("cov_eLOC0_eT", m_cov_eLOC0_eT);
+
+    addColumn("cov_eLOC1_eLOC0", m_cov_eLOC1_eLOC0);
+    addColumn("cov_eLOC1_eLOC1", m_cov_eLOC1_eLOC1);
+    addColumn("cov_eLOC1_ePHI", m_cov_eLOC1_ePHI);
+    addColumn("cov_eLOC1_eTHETA", m_cov_eLOC1_eTHETA);
+    addColumn("cov_eLOC1_eQOP", m_cov_eLOC1_eQOP);
+    addColumn("cov_eLOC1_eT", m_cov_eLOC1_eT);
+
+    addColumn("cov_ePHI_eLOC0", m_cov_ePHI_eLOC0);
+    addColumn("cov_ePHI_eLOC1", m_cov_ePHI_eLOC1);
+    addColumn("cov_ePHI_ePHI", m_cov_ePHI_ePHI);
+    addColumn("cov_ePHI_eTHETA", m_cov_ePHI_eTHETA);
+    addColumn("cov_ePHI_eQOP", m_cov_ePHI_eQOP);
+    addColumn("cov_ePHI_eT", m_cov_ePHI_eT);
+
+    addColumn("cov_eTHETA_eLOC0", m_cov_eTHETA_eLOC0);
+    addColumn("cov_eTHETA_eLOC1", m_cov_eTHETA_eLOC1);
+    addColumn("cov_eTHETA_ePHI", m_cov_eTHETA_ePHI);
+    addColumn("cov_eTHETA_eTHETA", m_cov_eTHETA_eTHETA);
+    addColumn("cov_eTHETA_eQOP", m_cov_eTHETA_eQOP);
+    addColumn("cov_eTHETA_eT", m_cov_eTHETA_eT);
+
+    addColumn("cov_eQOP_eLOC0", m_cov_eQOP_eLOC0);
+    addColumn("cov_eQOP_eLOC1", m_cov_eQOP_eLOC1);
+    addColumn("cov_eQOP_ePHI", m_cov_eQOP_ePHI);
+    addColumn("cov_eQOP_eTHETA", m_cov_eQOP_eTHETA);
+    addColumn("cov_eQOP_eQOP", m_cov_eQOP_eQOP);
+    addColumn("cov_eQOP_eT", m_cov_eQOP_eT);
+
+    addColumn("cov_eT_eLOC0", m_cov_eT_eLOC0);
+    addColumn("cov_eT_eLOC1", m_cov_eT_eLOC1);
+    addColumn("cov_eT_ePHI", m_cov_eT_ePHI);
+    addColumn("cov_eT_eTHETA", m_cov_eT_eTHETA);
+    addColumn("cov_eT_eQOP", m_cov_eT_eQOP);
+    addColumn("cov_eT_eT", m_cov_eT_eT);
+  }
+
+  if (m_cfg.writeGx2fSpecific) {
+    addColumn("nUpdatesGx2f", m_nUpdatesGx2f);
   }
 }
 
 ActsExamples::RootTrackSummaryWriter::~RootTrackSummaryWriter() {
+  m_outputNTuple.reset();
   m_outputFile->Close();
 }
 
+ActsExamples::ProcessCode ActsExamples::RootTrackSummaryWriter::shardOutput(
+    std::size_t worker) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile = detail::shardOutputFile(*m_outputFile, m_cfg.filePath,
+                                         m_cfg.fileMode, worker);
+  if (m_outputNTuple != nullptr) {
+    m_outputNTuple->moveTo(*m_outputFile);
+  }
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootTrackSummaryWriter::finalize() {
   m_outputFile->cd();
-  m_outputTree->Write();
+  if (m_outputNTuple) {
+    m_outputNTuple->write();
+  } else {
+    m_outputTree->Write();
+  }
   m_outputFile->Close();
 
   if (m_cfg.writeCovMat) {
@@ -528,7 +560,11 @@ ActsExamples::ProcessCode ActsExamples::RootTrackSummaryWriter::writeT(
   }
 
   // fill the variables
-  m_outputTree->Fill();
+  if (m_outputNTuple) {
+    m_outputNTuple->fill();
+  } else {
+    m_outputTree->Fill();
+  }
 
   m_trackNr.clear();
   m_nStates.clear();
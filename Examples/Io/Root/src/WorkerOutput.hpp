@@ -0,0 +1,68 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <ios>
+#include <string>
+#include <vector>
+
+#include <TFile.h>
+#include <TTree.h>
+
+namespace ActsExamples::detail {
+
+/// Path of the output file of a worker process, i.e. `<stem>_worker<i><ext>`
+/// next to the configured output file.
+///
+/// @param path is the configured output file path
+/// @param worker is the index of the worker process
+inline std::string workerFilePath(const std::string& path,
+                                  std::size_t worker) {
+  std::filesystem::path file(path);
+  file.replace_filename(file.stem().string() + "_worker" +
+                        std::to_string(worker) + file.extension().string());
+  return file.string();
+}
+
+/// Continue the trees of a writer in the output file of a worker process.
+///
+/// The trees are moved before any entry is filled, i.e. right after the
+/// fork. The file of the parent process is neither written nor closed in
+/// the worker, since its file descriptor is shared with the parent. The
+/// worker files can be merged with `hadd`.
+///
+/// @param file is the output file opened by the parent process
+/// @param path is the configured output file path
+/// @param mode is the file access mode
+/// @param worker is the index of the worker process
+/// @return the output file of the worker process
+inline TFile* shardOutputFile(TFile& file, const std::string& path,
+                              const std::string& mode, std::size_t worker) {
+  std::string workerPath = workerFilePath(path, worker);
+  TFile* workerFile = TFile::Open(workerPath.c_str(), mode.c_str());
+  if (workerFile == nullptr) {
+    throw std::ios_base::failure("Could not open '" + workerPath + "'");
+  }
+  // moving a tree removes it from the list of the file
+  std::vector<TTree*> trees;
+  for (TObject* object : *file.GetList()) {
+    if (auto* tree = dynamic_cast<TTree*>(object); tree != nullptr) {
+      trees.push_back(tree);
+    }
+  }
+  for (TTree* tree : trees) {
+    tree->SetDirectory(workerFile);
+  }
+  workerFile->cd();
+  return workerFile;
+}
+
+}  // namespace ActsExamples::detail
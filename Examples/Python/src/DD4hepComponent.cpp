@@ -56,9 +56,20 @@ PYBIND11_MODULE(ActsPythonBindingsDD4hep, m) {
   }
 
   {
-    py::class_<Acts::DD4hepFieldAdapter, Acts::MagneticFieldProvider,
-               std::shared_ptr<Acts::DD4hepFieldAdapter>>(m,
-                                                          "DD4hepFieldAdapter");
+    auto f =
+        py::class_<Acts::DD4hepFieldAdapter, Acts::MagneticFieldProvider,
+                   std::shared_ptr<Acts::DD4hepFieldAdapter>>(
+            m, "DD4hepFieldAdapter");
+
+    using Tabulation = Acts::DD4hepFieldAdapter::Tabulation;
+    auto t = py::class_<Tabulation>(f, "Tabulation").def(py::init<>());
+    ACTS_PYTHON_STRUCT_BEGIN(t, Tabulation);
+    ACTS_PYTHON_MEMBER(min);
+    ACTS_PYTHON_MEMBER(max);
+    ACTS_PYTHON_MEMBER(nPoints);
+    ACTS_PYTHON_STRUCT_END();
+
+    patchKwargsConstructor(t);
   }
 
   {
@@ -69,6 +80,7 @@ PYBIND11_MODULE(ActsPythonBindingsDD4hep, m) {
              py::overload_cast<DD4hep::DD4hepGeometryService::Config,
                                std::shared_ptr<const Acts::IMaterialDecorator>>(
                  &DD4hep::DD4hepDetector::finalize))
-        .def_property_readonly("field", &DD4hep::DD4hepDetector::field);
+        .def_property_readonly("field", &DD4hep::DD4hepDetector::field)
+        .def("tabulatedField", &DD4hep::DD4hepDetector::tabulatedField);
   }
 }
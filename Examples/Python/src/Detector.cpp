@@ -114,6 +114,7 @@ void addDetector(Context& ctx) {
     ACTS_PYTHON_MEMBER(sigmaInRot);
     ACTS_PYTHON_MEMBER(sigmaOutRot);
     ACTS_PYTHON_MEMBER(firstIovNominal);
+    ACTS_PYTHON_MEMBER(nPrefetchIovs);
     ACTS_PYTHON_MEMBER(decoratorLogLevel);
     ACTS_PYTHON_MEMBER(mode);
     ACTS_PYTHON_STRUCT_END();
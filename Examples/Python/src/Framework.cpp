@@ -16,7 +16,9 @@
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/Sequencer.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Numa.hpp"
 
+#include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -173,6 +175,8 @@ void addFramework(Context& ctx) {
           .def("addReader", &Sequencer::addReader)
           .def("addWriter", &Sequencer::addWriter)
           .def("addWhiteboardAlias", &Sequencer::addWhiteboardAlias)
+          .def("executeOnNumaNode", &Sequencer::executeOnNumaNode)
+          .def_property_readonly("numaNodes", &Sequencer::numaNodes)
           .def_property_readonly("config", &Sequencer::config)
           .def_property_readonly("fpeResult", &Sequencer::fpeResult)
           .def_property_readonly_static(
@@ -192,8 +196,12 @@ void addFramework(Context& ctx) {
   ACTS_PYTHON_MEMBER(fpeMasks);
   ACTS_PYTHON_MEMBER(failOnFirstFpe);
   ACTS_PYTHON_MEMBER(fpeStackTraceLength);
+  ACTS_PYTHON_MEMBER(numaAware);
+  ACTS_PYTHON_MEMBER(numProcesses);
   ACTS_PYTHON_STRUCT_END();
 
+  mex.def("currentNumaNode", &ActsExamples::currentNumaNode);
+
   auto fpem =
       py::class_<Sequencer::FpeMask>(sequencer, "_FpeMask")
           .def(py::init<>())
@@ -8,6 +8,7 @@
 
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "ActsExamples/HepMC/HepMCProcessExtractor.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3IndexedReader.hpp"
 #include "ActsExamples/Io/HepMC3/HepMC3Reader.hpp"
 #include "ActsExamples/Io/HepMC3/HepMC3Writer.hpp"
 
@@ -38,6 +39,10 @@ void addHepMC3(Context& ctx) {
 
   ACTS_PYTHON_DECLARE_READER(ActsExamples::HepMC3AsciiReader, hepmc3,
                              "HepMC3AsciiReader", inputDir, inputStem,
+                             outputEvents, outputParticles);
+
+  ACTS_PYTHON_DECLARE_READER(ActsExamples::HepMC3IndexedReader, hepmc3,
+                             "HepMC3IndexedReader", inputPath, outputParticles,
                              outputEvents);
 }
 }  // namespace Acts::Python
@@ -11,12 +11,15 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
+#include "ActsExamples/MagneticField/FieldMapBinaryIo.hpp"
 #include "ActsExamples/MagneticField/FieldMapRootIo.hpp"
 #include "ActsExamples/MagneticField/FieldMapTextIo.hpp"
+#include "ActsExamples/MagneticField/NumaReplicatedBField.hpp"
 
 #include <array>
 #include <cstddef>
@@ -27,6 +30,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -68,6 +72,31 @@ void addMagneticField(Context& ctx) {
              std::shared_ptr<Acts::NullBField>>(m, "NullBField")
       .def(py::init<>());
 
+  py::class_<ActsExamples::NumaReplicatedBField, Acts::MagneticFieldProvider,
+             std::shared_ptr<ActsExamples::NumaReplicatedBField>>(
+      mex, "NumaReplicatedBField")
+      .def(py::init(
+               [](const std::vector<
+                   std::shared_ptr<Acts::MagneticFieldProvider>>& replicas) {
+                 return std::make_shared<ActsExamples::NumaReplicatedBField>(
+                     std::vector<
+                         std::shared_ptr<const Acts::MagneticFieldProvider>>(
+                         replicas.begin(), replicas.end()));
+               }),
+           py::arg("replicas"))
+      .def("getField",
+           [](const ActsExamples::NumaReplicatedBField& self,
+              const Acts::Vector3& position) {
+             // lookup in the replica of the calling thread
+             auto cache = self.makeCache(Acts::MagneticFieldContext{});
+             auto field = self.getField(position, cache);
+             if (!field.ok()) {
+               throw std::runtime_error{"Field lookup failed: " +
+                                        field.error().message()};
+             }
+             return *field;
+           });
+
   {
     using Config = Acts::SolenoidBField::Config;
 
@@ -88,7 +117,11 @@ void addMagneticField(Context& ctx) {
         .def_readwrite("radius", &Config::radius)
         .def_readwrite("length", &Config::length)
         .def_readwrite("nCoils", &Config::nCoils)
-        .def_readwrite("bMagCenter", &Config::bMagCenter);
+        .def_readwrite("bMagCenter", &Config::bMagCenter)
+        .def_readwrite("tabulationTolerance", &Config::tabulationTolerance)
+        .def_readwrite("tabulationRMax", &Config::tabulationRMax)
+        .def_readwrite("tabulationZMax", &Config::tabulationZMax)
+        .def_readwrite("tabulationMaxBins", &Config::tabulationMaxBins);
   }
 
   mex.def(
@@ -115,6 +148,11 @@ void addMagneticField(Context& ctx) {
               firstOctant);
           return std::make_shared<
               ActsExamples::detail::InterpolatedMagneticField3>(std::move(map));
+        } else if (file.extension() == ".bin") {
+          auto map =
+              ActsExamples::makeMagneticFieldMapXyzFromBinary(file.native());
+          return std::make_shared<
+              ActsExamples::detail::InterpolatedMagneticField3>(std::move(map));
         } else {
           throw std::runtime_error("Unsupported magnetic field map file type");
         }
@@ -147,6 +185,11 @@ void addMagneticField(Context& ctx) {
               firstQuadrant);
           return std::make_shared<
               ActsExamples::detail::InterpolatedMagneticField2>(std::move(map));
+        } else if (file.extension() == ".bin") {
+          auto map =
+              ActsExamples::makeMagneticFieldMapRzFromBinary(file.native());
+          return std::make_shared<
+              ActsExamples::detail::InterpolatedMagneticField2>(std::move(map));
         } else {
           throw std::runtime_error("Unsupported magnetic field map file type");
         }
@@ -155,6 +198,14 @@ void addMagneticField(Context& ctx) {
       py::arg("lengthUnit") = Acts::UnitConstants::mm,
       py::arg("BFieldUnit") = Acts::UnitConstants::T,
       py::arg("firstQuadrant") = false);
+
+  mex.def("writeMagneticFieldMapXyzToBinary",
+          &ActsExamples::writeMagneticFieldMapXyzToBinary, py::arg("field"),
+          py::arg("file"));
+
+  mex.def("writeMagneticFieldMapRzToBinary",
+          &ActsExamples::writeMagneticFieldMapRzToBinary, py::arg("field"),
+          py::arg("file"));
 }
 
 }  // namespace Acts::Python
@@ -14,7 +14,10 @@
 #include <Acts/Visualization/ObjVisualization3D.hpp>
 #include <Acts/Visualization/ViewConfig.hpp>
 
+#include <cstddef>
+#include <fstream>
 #include <memory>
+#include <string>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -41,14 +44,26 @@ void addObj(Context& ctx) {
                const GeometryContext& viewContext,
                const std::array<int, 3>& viewRgb, const std::string& fileName) {
               Acts::ViewConfig sConfig = Acts::ViewConfig{viewRgb};
-              Acts::GeometryView3D view3D;
+              Acts::GeometryView3D::TessellationCache cache;
               Acts::ObjVisualization3D obj;
 
+              std::ofstream os;
+              std::ofstream mos;
+              obj.open(fileName, os, mos);
+
+              // write in chunks to bound the memory for large collections
+              constexpr std::size_t flushSurfaces = 1000;
+              std::size_t nSurfaces = 0;
               for (const auto& surface : surfaces) {
-                view3D.drawSurface(obj, *surface, viewContext,
-                                   Acts::Transform3::Identity(), sConfig);
+                GeometryView3D::drawPolyhedron(
+                    obj,
+                    cache.polyhedron(*surface, viewContext, sConfig.nSegments),
+                    sConfig);
+                if (++nSurfaces % flushSurfaces == 0) {
+                  obj.flush(os, mos);
+                }
               }
-              obj.write(fileName);
+              obj.flush(os, mos);
             });
   }
 }
@@ -324,12 +324,13 @@ void addOutput(Context& ctx) {
   ACTS_PYTHON_DECLARE_WRITER(
       ActsExamples::RootTrackStatesWriter, mex, "RootTrackStatesWriter",
       inputTracks, inputParticles, inputSimHits, inputMeasurementParticlesMap,
-      inputMeasurementSimHitsMap, filePath, treeName, fileMode);
+      inputMeasurementSimHitsMap, filePath, treeName, fileMode, writeRNTuple);
 
   ACTS_PYTHON_DECLARE_WRITER(
       ActsExamples::RootTrackSummaryWriter, mex, "RootTrackSummaryWriter",
       inputTracks, inputParticles, inputMeasurementParticlesMap, filePath,
-      treeName, fileMode, writeCovMat, writeGsfSpecific, writeGx2fSpecific);
+      treeName, fileMode, writeCovMat, writeGsfSpecific, writeGx2fSpecific,
+      writeRNTuple);
 
   ACTS_PYTHON_DECLARE_WRITER(
       ActsExamples::VertexPerformanceWriter, mex, "VertexPerformanceWriter",
@@ -6,6 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/Geometry/GeometryHierarchyMap.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
@@ -16,6 +17,8 @@
 #include "Acts/Seeding/SeedFinderOrthogonalConfig.hpp"
 #include "Acts/Seeding/SpacePointGrid.hpp"
 #include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/RoiDescriptor.hpp"
+#include "Acts/TrackFinding/TrackFinalization.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 #include "ActsExamples/EventData/Track.hpp"
@@ -24,6 +27,7 @@
 #include "ActsExamples/TrackFinding/SeedingFTFAlgorithm.hpp"
 #include "ActsExamples/TrackFinding/SeedingOrthogonalAlgorithm.hpp"
 #include "ActsExamples/TrackFinding/SpacePointMaker.hpp"
+#include "ActsExamples/TrackFinding/TrackFinalizingAlgorithm.hpp"
 #include "ActsExamples/TrackFinding/TrackFindingAlgorithm.hpp"
 #include "ActsExamples/TrackFinding/TrackParamsEstimationAlgorithm.hpp"
 #include "ActsExamples/Utilities/MeasurementMapSelector.hpp"
@@ -62,10 +66,24 @@ namespace Acts::Python {
 void addTrackFinding(Context& ctx) {
   auto [m, mex] = ctx.get("main", "examples");
 
+  py::class_<Acts::RoiDescriptor, std::shared_ptr<Acts::RoiDescriptor>>(
+      m, "RoiDescriptor")
+      .def(py::init<double, double, double, double, double, double, double,
+                    double, double>(),
+           py::arg("eta"), py::arg("etaMinus"), py::arg("etaPlus"),
+           py::arg("phi"), py::arg("phiMinus"), py::arg("phiPlus"),
+           py::arg("zed") = 0,
+           py::arg("zedMinus") = -Acts::RoiDescriptor::zedWidthDefault(),
+           py::arg("zedPlus") = Acts::RoiDescriptor::zedWidthDefault())
+      .def(py::init<bool>(), py::arg("fullscan"))
+      .def("contains", &Acts::RoiDescriptor::contains, py::arg("z"),
+           py::arg("r"), py::arg("phi"))
+      .def_property_readonly("isFullscan", &Acts::RoiDescriptor::isFullscan);
+
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::SpacePointMaker, mex,
                                 "SpacePointMaker", inputSourceLinks,
                                 inputMeasurements, outputSpacePoints,
-                                trackingGeometry, geometrySelection);
+                                trackingGeometry, geometrySelection, roi);
 
   {
     using Config = Acts::SeedFilterConfig;
@@ -265,7 +283,7 @@ void addTrackFinding(Context& ctx) {
       ActsExamples::SeedingAlgorithm, mex, "SeedingAlgorithm", inputSpacePoints,
       outputSeeds, seedFilterConfig, seedFinderConfig, seedFinderOptions,
       gridConfig, gridOptions, allowSeparateRMax, zBinNeighborsTop,
-      zBinNeighborsBottom, numPhiNeighbors);
+      zBinNeighborsBottom, numPhiNeighbors, roi);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::SeedingOrthogonalAlgorithm, mex,
                                 "SeedingOrthogonalAlgorithm", inputSpacePoints,
@@ -292,6 +310,14 @@ void addTrackFinding(Context& ctx) {
       magneticField, bFieldMin, initialSigmas, initialVarInflation,
       particleHypothesis);
 
+  py::enum_<Acts::ConstVectorMultiTrajectory::CovarianceStorage>(
+      m, "CovarianceStorage")
+      .value("Full", Acts::ConstVectorMultiTrajectory::CovarianceStorage::Full)
+      .value("Packed",
+             Acts::ConstVectorMultiTrajectory::CovarianceStorage::Packed)
+      .value("PackedFloat",
+             Acts::ConstVectorMultiTrajectory::CovarianceStorage::PackedFloat);
+
   {
     using Alg = ActsExamples::TrackFindingAlgorithm;
     using Config = Alg::Config;
@@ -327,10 +353,24 @@ void addTrackFinding(Context& ctx) {
     ACTS_PYTHON_MEMBER(measurementSelectorCfg);
     ACTS_PYTHON_MEMBER(trackSelectorCfg);
     ACTS_PYTHON_MEMBER(backward);
+    ACTS_PYTHON_MEMBER(smoothing);
+    ACTS_PYTHON_MEMBER(trackStateCovarianceStorage);
     ACTS_PYTHON_MEMBER(maxSteps);
+    ACTS_PYTHON_MEMBER(roi);
+    ACTS_PYTHON_MEMBER(trackingGeometry);
     ACTS_PYTHON_STRUCT_END();
   }
 
+  py::enum_<Acts::TrackExtrapolationStrategy>(m, "TrackExtrapolationStrategy")
+      .value("first", Acts::TrackExtrapolationStrategy::first)
+      .value("last", Acts::TrackExtrapolationStrategy::last)
+      .value("firstOrLast", Acts::TrackExtrapolationStrategy::firstOrLast);
+
+  ACTS_PYTHON_DECLARE_ALGORITHM(
+      ActsExamples::TrackFinalizingAlgorithm, mex, "TrackFinalizingAlgorithm",
+      inputTracks, outputTracks, trackingGeometry, magneticField,
+      referenceSurface, extrapolationStrategy, maxSteps, trackSelectorCfg);
+
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::TrajectoriesToPrototracks, mex,
                                 "TrajectoriesToPrototracks", inputTrajectories,
                                 outputProtoTracks);
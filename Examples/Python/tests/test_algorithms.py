@@ -7,6 +7,7 @@ from acts.examples import (
     IterativeVertexFinderAlgorithm,
     SpacePointMaker,
     TrackFindingAlgorithm,
+    TrackFinalizingAlgorithm,
     SeedingAlgorithm,
     TrackParamsEstimationAlgorithm,
     EventGenerator,
@@ -41,6 +42,7 @@ from helpers import geant4Enabled, hepmc3Enabled
         IterativeVertexFinderAlgorithm,
         SpacePointMaker,
         TrackFindingAlgorithm,
+    TrackFinalizingAlgorithm,
         SeedingAlgorithm,
         TrackParamsEstimationAlgorithm,
         EventGenerator,
@@ -1,9 +1,15 @@
+import subprocess
+import sys
+import threading
+
 import pytest
 
 import acts
 
 import acts.examples
 
+from helpers import rootEnabled
+
 
 def test_logging():
     for l in ("VERBOSE", "DEBUG", "INFO", "WARNING", "ERROR", "FATAL"):
@@ -71,6 +77,146 @@ def test_sequencer_multi_threaded(ptcl_gun, capfd):
     assert "Processed 2 events" in cap.out
 
 
+def test_sequencer_numa_aware(ptcl_gun, capfd):
+    # Falls back to a single task arena on machines with one NUMA node
+    s = acts.examples.Sequencer(numThreads=2, events=4, numaAware=True)
+    assert s.numaNodes >= 1
+
+    # a distinct field per node to identify the replica of a lookup
+    replicas = []
+    for node in range(s.numaNodes):
+        s.executeOnNumaNode(
+            node,
+            lambda: replicas.append(
+                acts.ConstantBField(acts.Vector3(0, 0, 2 + len(replicas)))
+            ),
+        )
+    field = acts.examples.NumaReplicatedBField(replicas)
+    assert len(replicas) == s.numaNodes
+
+    class FieldLookupAlg(acts.examples.IAlgorithm):
+        events_seen = 0
+
+        def execute(self, ctx):
+            node = acts.examples.currentNumaNode()
+            assert node < len(replicas)
+            assert field.getField(acts.Vector3(0, 0, 0))[2] == 2 + node
+            self.events_seen += 1
+            return acts.examples.ProcessCode.SUCCESS
+
+    ptcl_gun(s)
+    alg = FieldLookupAlg("field_lookup", acts.logging.INFO)
+    s.addAlgorithm(alg)
+    s.run()
+    assert alg.events_seen == 4
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 4 events" in cap.out
+
+
+MULTI_PROCESS_SCRIPT = """
+import sys
+import acts
+import acts.examples
+
+u = acts.UnitConstants
+outputDir, writer = sys.argv[1:3]
+s = acts.examples.Sequencer(numThreads=1, numProcesses=2, events=4)
+s.addReader(
+    acts.examples.EventGenerator(
+        level=acts.logging.INFO,
+        generators=[
+            acts.examples.EventGenerator.Generator(
+                multiplicity=acts.examples.FixedMultiplicityGenerator(n=2),
+                vertex=acts.examples.GaussianVertexGenerator(
+                    stddev=acts.Vector4(0, 0, 0, 0), mean=acts.Vector4(0, 0, 0, 0)
+                ),
+                particles=acts.examples.ParametricParticleGenerator(
+                    p=(1 * u.GeV, 10 * u.GeV), numParticles=2
+                ),
+            )
+        ],
+        outputParticles="particles_input",
+        randomNumbers=acts.examples.RandomNumbers(seed=42),
+    )
+)
+if writer == "csv":
+    s.addWriter(
+        acts.examples.CsvParticleWriter(
+            level=acts.logging.INFO,
+            inputParticles="particles_input",
+            outputDir=outputDir,
+            outputStem="particles",
+        )
+    )
+else:
+    s.addWriter(
+        acts.examples.RootParticleWriter(
+            level=acts.logging.INFO,
+            inputParticles="particles_input",
+            filePath=outputDir + "/particles.root",
+        )
+    )
+s.run()
+"""
+
+
+def test_sequencer_multi_process(tmp_path):
+    # the workers are forked from a fresh process without running threads
+    res = subprocess.run(
+        [sys.executable, "-c", MULTI_PROCESS_SCRIPT, str(tmp_path), "csv"],
+        capture_output=True,
+        text=True,
+    )
+    assert res.returncode == 0, res.stdout + res.stderr
+    assert "in 2 worker processes" in res.stdout
+    assert "Processed 4 events" in res.stdout
+    # the events of both workers are written
+    assert sorted(f.name for f in tmp_path.iterdir()) == [
+        f"event{i:09}-particles.csv" for i in range(4)
+    ]
+
+
+@pytest.mark.skipif(not rootEnabled, reason="ROOT not set up")
+def test_sequencer_multi_process_root(tmp_path):
+    res = subprocess.run(
+        [sys.executable, "-c", MULTI_PROCESS_SCRIPT, str(tmp_path), "root"],
+        capture_output=True,
+        text=True,
+    )
+    assert res.returncode == 0, res.stdout + res.stderr
+    assert "Processed 4 events" in res.stdout
+
+    import ROOT
+
+    ROOT.PyConfig.IgnoreCommandLineOptions = True
+    ROOT.gROOT.SetBatch(True)
+
+    # every worker writes its events to its own file, which can be merged
+    for worker in range(2):
+        rf = ROOT.TFile.Open(str(tmp_path / f"particles_worker{worker}.root"))
+        tree = rf.Get("particles")
+        assert tree.GetEntries() == 2
+        events = sorted(entry.event_id for entry in tree)
+        assert events == [2 * worker, 2 * worker + 1]
+        rf.Close()
+
+
+def test_sequencer_multi_process_running_threads(ptcl_gun):
+    # forking with other threads running is refused
+    stop = threading.Event()
+    thread = threading.Thread(target=stop.wait)
+    thread.start()
+    try:
+        s = acts.examples.Sequencer(numThreads=1, numProcesses=2, events=4)
+        ptcl_gun(s)
+        with pytest.raises(RuntimeError):
+            s.run()
+    finally:
+        stop.set()
+        thread.join()
+
+
 def test_random_number():
     rnd = acts.examples.RandomNumbers(seed=42)
 
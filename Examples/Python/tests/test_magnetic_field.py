@@ -35,3 +35,29 @@ def test_solenoid(conf_const):
     )
 
     assert isinstance(field, acts.examples.InterpolatedMagneticField2)
+
+
+def test_field_map_binary(tmp_path):
+    solenoid = acts.SolenoidBField(
+        radius=1200 * u.mm,
+        length=6000 * u.mm,
+        bMagCenter=2 * u.T,
+        nCoils=1194,
+    )
+
+    field = acts.solenoidFieldMap(
+        rlim=(0, 1200 * u.mm),
+        zlim=(-5000 * u.mm, 5000 * u.mm),
+        nbins=(10, 10),
+        field=solenoid,
+    )
+
+    file = tmp_path / "solenoid.bin"
+    acts.examples.writeMagneticFieldMapRzToBinary(field, str(file))
+    assert file.exists()
+
+    cached = acts.examples.MagneticFieldMapRz(str(file))
+    assert isinstance(cached, acts.examples.InterpolatedMagneticField2)
+
+    with pytest.raises(RuntimeError):
+        acts.examples.MagneticFieldMapXyz(str(file))
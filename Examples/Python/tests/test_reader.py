@@ -6,6 +6,7 @@ import multiprocessing
 from helpers import (
     geant4Enabled,
     edm4hepEnabled,
+    hepmc3Enabled,
     AssertCollectionExistsAlg,
 )
 from common import getOpenDataDetectorDirectory
@@ -353,6 +354,104 @@ def generate_input_test_edm4hep_simhit_reader(input, output):
     ddsim.run()
 
 
+@pytest.mark.skipif(not hepmc3Enabled, reason="HepMC3 not set up")
+def test_hepmc3_indexed_reader(tmp_path):
+    from acts.examples.hepmc3 import HepMC3AsciiReader, HepMC3IndexedReader
+
+    nevents = 20
+    header = [
+        "HepMC::Version 3.02.05",
+        "HepMC::Asciiv3-START_EVENT_LISTING",
+    ]
+    footer = ["HepMC::Asciiv3-END_EVENT_LISTING"]
+    records = []
+    for i in range(nevents):
+        # every other event in MeV and cm
+        scale, units = (1000, "U MEV CM") if i % 2 else (1, "U GEV MM")
+        records.append(
+            [
+                f"E {i} 1 3",
+                units,
+                f"P 1 0 2212 0 0 {100 * scale} {100 * scale} {0.938 * scale} 4",
+                "V -1 0 [1] @ 0 0 1 0",
+                f"P 2 -1 211 {(i + 1) * scale} 0 0 {(i + 1) * scale} "
+                f"{0.1396 * scale} 1",
+                f"P 3 -1 -211 0 {(i + 1) * scale} 0 {(i + 1) * scale} "
+                f"{0.1396 * scale} 1",
+            ]
+        )
+
+    # the sequential reader reads one file per event
+    inputDir = tmp_path / "per_event"
+    inputDir.mkdir()
+    for i, record in enumerate(records):
+        (inputDir / f"event{i:09d}-events.hepmc3").write_text(
+            "\n".join(header + record + footer) + "\n"
+        )
+    inputPath = tmp_path / "events.hepmc3"
+    inputPath.write_text("\n".join(header + sum(records, []) + footer) + "\n")
+
+    (tmp_path / "sequential").mkdir()
+    (tmp_path / "indexed").mkdir()
+
+    s = Sequencer(numThreads=1)
+    s.addReader(
+        HepMC3AsciiReader(
+            level=acts.logging.INFO,
+            inputDir=str(inputDir),
+            inputStem="events",
+            outputEvents="hepmc3-events",
+            outputParticles="particles",
+        )
+    )
+    s.addWriter(
+        CsvParticleWriter(
+            level=acts.logging.INFO,
+            inputParticles="particles",
+            outputDir=str(tmp_path / "sequential"),
+            outputStem="particles",
+        )
+    )
+    s.run()
+
+    s = Sequencer(numThreads=2)
+    s.addReader(
+        HepMC3IndexedReader(
+            level=acts.logging.INFO,
+            inputPath=str(inputPath),
+            outputParticles="particles",
+            outputEvents="hepmc3-events",
+        )
+    )
+
+    alg = AssertCollectionExistsAlg(
+        ["particles", "hepmc3-events"], "check_alg", acts.logging.WARNING
+    )
+    s.addAlgorithm(alg)
+    s.addWriter(
+        CsvParticleWriter(
+            level=acts.logging.INFO,
+            inputParticles="particles",
+            outputDir=str(tmp_path / "indexed"),
+            outputStem="particles",
+        )
+    )
+
+    s.run()
+
+    assert alg.events_seen == nevents
+
+    # the same particles as read sequentially
+    sequential = sorted((tmp_path / "sequential").iterdir())
+    indexed = sorted((tmp_path / "indexed").iterdir())
+    assert [f.name for f in indexed] == [f.name for f in sequential]
+    assert len(indexed) == nevents
+    for seq, idx in zip(sequential, indexed):
+        assert idx.read_text() == seq.read_text()
+        # the two final state pions
+        assert len(idx.read_text().splitlines()) == 3
+
+
 @pytest.mark.slow
 @pytest.mark.edm4hep
 @pytest.mark.skipif(not edm4hepEnabled, reason="EDM4hep is not set up")
@@ -50,6 +50,9 @@ void AlignedDetectorWithOptions::addOptions(
       "align-firstnominal",
       boost::program_options::value<bool>()->default_value(false),
       "Keep the first iov batch nominal.")(
+      "align-prefetch",
+      boost::program_options::value<unsigned int>()->default_value(0),
+      "Number of upcoming IOVs prepared in the background (external mode).")(
       "align-mode",
       boost::program_options::value<std::string>()->default_value("internal"));
 }
@@ -88,6 +91,7 @@ auto AlignedDetectorWithOptions::finalize(
   cfg.sigmaInRot = vm["align-sigma-irot"].template as<double>() * 0.001;
   cfg.sigmaOutRot = vm["align-sigma-orot"].template as<double>() * 0.001;
   cfg.firstIovNominal = vm["align-firstnominal"].template as<bool>();
+  cfg.nPrefetchIovs = vm["align-prefetch"].template as<unsigned int>();
 
   auto mode = vm["align-mode"].as<std::string>();
   if (mode == "external") {
@@ -14,6 +14,7 @@
 #include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/Framework/Sequencer.hpp"
+#include "ActsExamples/MagneticField/FieldMapBinaryIo.hpp"
 #include "ActsExamples/MagneticField/FieldMapRootIo.hpp"
 #include "ActsExamples/MagneticField/FieldMapTextIo.hpp"
 #include "ActsExamples/MagneticField/ScalableBFieldService.hpp"
@@ -46,8 +47,9 @@ void ActsExamples::Options::addMagneticFieldOptions(Description& desc) {
       "Scaling factor for the event-dependent field strength scaling. A unit "
       "value means that the field strength stays the same for every event.");
   opt("bf-map-file", value<std::string>(),
-      "Read a magnetic field map from the given file. ROOT and text file "
-      "formats are supported. Only used if no constant field is given.");
+      "Read a magnetic field map from the given file. ROOT, text and binary "
+      "(.bin) file formats are supported. Only used if no constant field is "
+      "given.");
   opt("bf-map-tree", value<std::string>()->default_value("bField"),
       "Name of the TTree in the ROOT file. Only used if the field map is read "
       "from a ROOT file.");
@@ -135,12 +137,16 @@ ActsExamples::Options::readMagneticField(const Variables& vars) {
         vars["bf-map-fieldscale-tesla"].as<double>() * Acts::UnitConstants::T;
 
     bool readRoot = false;
+    bool readBinary = false;
     if (file.extension() == ".root") {
       ACTS_INFO("Read magnetic field map from ROOT file '" << file << "'");
       readRoot = true;
     } else if (file.extension() == ".txt") {
       ACTS_INFO("Read magnetic field map from text file '" << file << "'");
       readRoot = false;
+    } else if (file.extension() == ".bin") {
+      ACTS_INFO("Read magnetic field map from binary file '" << file << "'");
+      readBinary = true;
     } else {
       ACTS_ERROR("'" << file
                      << "' is an unsupported magnetic field map file type");
@@ -154,7 +160,11 @@ ActsExamples::Options::readMagneticField(const Variables& vars) {
       };
 
       ACTS_INFO("Use XYZ field map");
-      if (readRoot) {
+      if (readBinary) {
+        auto map = makeMagneticFieldMapXyzFromBinary(file.native());
+        return std::make_shared<InterpolatedMagneticField3>(std::move(map));
+
+      } else if (readRoot) {
         auto map = makeMagneticFieldMapXyzFromRoot(
             std::move(mapBins), file.native(), tree, lengthUnit, fieldUnit,
             useOctantOnly);
@@ -174,7 +184,11 @@ ActsExamples::Options::readMagneticField(const Variables& vars) {
       };
 
       ACTS_INFO("Use RZ field map");
-      if (readRoot) {
+      if (readBinary) {
+        auto map = makeMagneticFieldMapRzFromBinary(file.native());
+        return std::make_shared<InterpolatedMagneticField2>(std::move(map));
+
+      } else if (readRoot) {
         auto map = makeMagneticFieldMapRzFromRoot(
             std::move(mapBins), file.native(), tree, lengthUnit, fieldUnit,
             useOctantOnly);
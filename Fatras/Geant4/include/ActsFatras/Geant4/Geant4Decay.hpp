@@ -9,22 +9,28 @@
 #pragma once
 
 #include "Acts/Definitions/PdgParticle.hpp"
-#include "Acts/Definitions/Units.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
-#include "ActsFatras/Geant4/PDGtoG4Converter.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
+#include <memory>
 #include <random>
+#include <unordered_map>
 #include <vector>
 
-#include "G4ParticleDefinition.hh"
-
 class G4RunManager;
+class G4VDecayChannel;
 
 namespace ActsFatras {
 
 /// Handle particle decays using the Geant4 decay models.
+///
+/// Lifetimes, decay channels and branching ratios are extracted once from
+/// the Geant4 particle and decay tables on construction. The decay channel is
+/// selected with an alias sampler from the given random number generator,
+/// Geant4 is only used for the final state kinematics of the channel.
 class Geant4Decay {
  public:
   using Scalar = Particle::Scalar;
@@ -53,49 +59,73 @@ class Geant4Decay {
   std::vector<Particle> run(generator_t& generator, Particle& particle) const;
 
  private:
+  /// Decay properties of a single particle type.
+  struct DecayTable {
+    /// Mean proper lifetime, infinite for stable particles
+    Scalar lifetime = std::numeric_limits<Scalar>::infinity();
+    /// Kinematically allowed decay channels
+    std::vector<G4VDecayChannel*> channels;
+    /// Alias table of the channel branching ratios
+    std::vector<Scalar> probabilities;
+    std::vector<std::size_t> aliases;
+  };
+
+  /// Find the decay table of a particle type.
+  ///
+  /// @param [in] pdg The PDG ID of the particle
+  ///
+  /// @return Pointer to the decay table, nullptr for unknown particles
+  const DecayTable* findDecayTable(Acts::PdgParticle pdg) const;
+
   /// This function evaluates the decay products of a given particle
   ///
   /// @param [in] parent The decaying particle
+  /// @param [in] channel The selected decay channel
   ///
   /// @return Vector containing the decay products
-  std::vector<Particle> decayParticle(const Particle& parent) const;
+  std::vector<Particle> decayParticle(const Particle& parent,
+                                      G4VDecayChannel& channel) const;
 
   mutable G4RunManager* m_g4RunManager;  ///< for dummy G4 initialization
 
-  PDGtoG4Converter
-      m_pdgToG4Conv;  ///< Handle for converting a PDG ID into a Geant4 particle
+  /// The decay tables by PDG ID, shared between copies of the decay module
+  std::shared_ptr<const std::unordered_map<Acts::PdgParticle, DecayTable>>
+      m_decayTables;
 };
 
 template <typename generator_t>
 Particle::Scalar Geant4Decay::generateProperTimeLimit(
     generator_t& generator, const Particle& particle) const {
-  // Get the particle properties
-  const Acts::PdgParticle pdgCode = particle.pdg();
-  // Keep muons stable
-  if (makeAbsolutePdgParticle(pdgCode) == Acts::PdgParticle::eMuon) {
+  // Fast exit if the particle is unknown or stable
+  const DecayTable* table = findDecayTable(particle.pdg());
+  if (table == nullptr || !std::isfinite(table->lifetime)) {
     return std::numeric_limits<Scalar>::infinity();
   }
 
-  // Get the Geant4 particle
-  G4ParticleDefinition* pDef = m_pdgToG4Conv.getParticleDefinition(pdgCode);
-
-  // Fast exit if the particle is stable
-  if (!pDef || pDef->GetPDGStable()) {
-    return std::numeric_limits<Scalar>::infinity();
-  }
-
-  // Get average lifetime
-  constexpr Scalar convertTime = Acts::UnitConstants::mm / CLHEP::s;
-  const Scalar tau = pDef->GetPDGLifeTime() * convertTime;
   // Sample & return the lifetime
   std::uniform_real_distribution<Scalar> uniformDistribution{0., 1.};
 
-  return -tau * std::log(uniformDistribution(generator));
+  return -table->lifetime * std::log(uniformDistribution(generator));
 }
 
 template <typename generator_t>
-std::vector<Particle> Geant4Decay::run(generator_t& /*generator*/,
+std::vector<Particle> Geant4Decay::run(generator_t& generator,
                                        Particle& particle) const {
-  return decayParticle(particle);
+  const DecayTable* table = findDecayTable(particle.pdg());
+  if (table == nullptr || table->channels.empty()) {
+    return {};
+  }
+
+  // Select the decay channel from the alias table
+  std::uniform_real_distribution<Scalar> uniformDistribution{0., 1.};
+  const std::size_t nChannels = table->channels.size();
+  std::size_t channel = std::min(
+      static_cast<std::size_t>(uniformDistribution(generator) * nChannels),
+      nChannels - 1);
+  if (uniformDistribution(generator) >= table->probabilities[channel]) {
+    channel = table->aliases[channel];
+  }
+
+  return decayParticle(particle, *table->channels[channel]);
 }
 }  // namespace ActsFatras
@@ -28,6 +28,12 @@ class PDGtoG4Converter {
   /// @return Pointer to the Geant4 particle
   G4ParticleDefinition* getParticleDefinition(Acts::PdgParticle pdgCode) const;
 
+  /// Access all predefined particles by their PDG ID.
+  const std::unordered_map<Acts::PdgParticle, G4ParticleDefinition*>&
+  particleDefinitions() const {
+    return m_pdgG4ParticleMap;
+  }
+
  private:
   /// Fills the internal lookup with PDG ids and their Geant4 particles.
   void fillPredefinedParticles();
@@ -10,41 +10,124 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Common.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/ProcessType.hpp"
 #include "ActsFatras/Geant4/DummyDetectorConstruction.hpp"
+#include "ActsFatras/Geant4/PDGtoG4Converter.hpp"
 
 #include <cstdint>
+#include <cstdlib>
 #include <utility>
 
 #include "G4DecayProducts.hh"
 #include "G4DecayTable.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4VDecayChannel.hh"
+
+namespace {
+
+/// Fill the alias table for the given weights with Vose's method.
+///
+/// A channel `i` is selected with probability `probabilities[i]` from a
+/// uniformly drawn index and with `aliases[i]` otherwise.
+void fillAliasTable(const std::vector<double>& weights,
+                    std::vector<double>& probabilities,
+                    std::vector<std::size_t>& aliases) {
+  const std::size_t n = weights.size();
+  double sum = 0;
+  for (double w : weights) {
+    sum += w;
+  }
+  probabilities.resize(n);
+  aliases.resize(n);
+  std::vector<std::size_t> small;
+  std::vector<std::size_t> large;
+  for (std::size_t i = 0; i < n; ++i) {
+    probabilities[i] = weights[i] * n / sum;
+    aliases[i] = i;
+    (probabilities[i] < 1. ? small : large).push_back(i);
+  }
+  while (!small.empty() && !large.empty()) {
+    std::size_t s = small.back();
+    std::size_t l = large.back();
+    small.pop_back();
+    aliases[s] = l;
+    probabilities[l] -= 1. - probabilities[s];
+    if (probabilities[l] < 1.) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // remaining entries are only off by rounding
+  for (std::size_t i : small) {
+    probabilities[i] = 1.;
+  }
+  for (std::size_t i : large) {
+    probabilities[i] = 1.;
+  }
+}
+
+}  // namespace
 
 ActsFatras::Geant4Decay::Geant4Decay()
-    : m_g4RunManager(ensureGeant4RunManager()) {}
+    : m_g4RunManager(ensureGeant4RunManager()) {
+  constexpr Scalar convertTime = Acts::UnitConstants::mm / CLHEP::s;
 
-std::vector<ActsFatras::Particle> ActsFatras::Geant4Decay::decayParticle(
-    const ActsFatras::Particle& parent) const {
-  std::vector<Particle> children;
+  auto tables =
+      std::make_shared<std::unordered_map<Acts::PdgParticle, DecayTable>>();
+  PDGtoG4Converter pdgToG4Conv;
+  for (const auto& [pdg, pDef] : pdgToG4Conv.particleDefinitions()) {
+    DecayTable& table = (*tables)[pdg];
+    // Keep muons stable
+    if (pDef->GetPDGStable() ||
+        makeAbsolutePdgParticle(pdg) == Acts::PdgParticle::eMuon) {
+      continue;
+    }
+    table.lifetime = pDef->GetPDGLifeTime() * convertTime;
 
-  // Find the particle type that will decay
-  G4ParticleDefinition* pDef =
-      m_pdgToG4Conv.getParticleDefinition(parent.pdg());
-  if (pDef == nullptr) {
-    return children;
-  }
-  // Get the particles decay table
-  G4DecayTable* dt = pDef->GetDecayTable();
-  if (dt == nullptr) {
-    return children;
+    G4DecayTable* dt = pDef->GetDecayTable();
+    if (dt == nullptr) {
+      continue;
+    }
+    std::vector<double> branchingRatios;
+    for (G4int i = 0; i < dt->entries(); ++i) {
+      G4VDecayChannel* channel = dt->GetDecayChannel(i);
+      if (channel == nullptr || channel->GetBR() <= 0. ||
+          !channel->IsOKWithParentMass(pDef->GetPDGMass())) {
+        continue;
+      }
+      table.channels.push_back(channel);
+      branchingRatios.push_back(channel->GetBR());
+    }
+    if (!table.channels.empty()) {
+      fillAliasTable(branchingRatios, table.probabilities, table.aliases);
+    }
   }
-  // Select a decay channel
-  G4VDecayChannel* channel = dt->SelectADecayChannel();
-  if (channel == nullptr) {
-    return children;
+  // Neutral anti-particles without their own definition use the particle
+  for (const auto& [pdg, pDef] : pdgToG4Conv.particleDefinitions()) {
+    if (std::abs(pDef->GetPDGCharge()) < 0.1) {
+      const auto anti = static_cast<Acts::PdgParticle>(-pdg);
+      if (tables->find(anti) == tables->end()) {
+        (*tables)[anti] = (*tables)[pdg];
+      }
+    }
   }
+  m_decayTables = std::move(tables);
+}
+
+const ActsFatras::Geant4Decay::DecayTable*
+ActsFatras::Geant4Decay::findDecayTable(Acts::PdgParticle pdg) const {
+  auto it = m_decayTables->find(pdg);
+  return (it != m_decayTables->end()) ? &it->second : nullptr;
+}
+
+std::vector<ActsFatras::Particle> ActsFatras::Geant4Decay::decayParticle(
+    const ActsFatras::Particle& parent, G4VDecayChannel& channel) const {
+  std::vector<Particle> children;
+
   // Get the decay products from the selected channel
-  G4DecayProducts* products = channel->DecayIt();
+  G4DecayProducts* products = channel.DecayIt();
   if (products == nullptr) {
     return children;
   }
@@ -78,6 +161,8 @@ std::vector<ActsFatras::Particle> ActsFatras::Geant4Decay::decayParticle(
 
     // Store the particle
     children.push_back(std::move(childParticle));
+    delete prod;
   }
+  delete products;
   return children;
 }
@@ -17,6 +17,7 @@
 #include "Acts/Propagator/ActionList.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Propagator/detail/ParameterTraits.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
@@ -76,6 +77,33 @@ struct SingleParticleSimulation {
       const Acts::GeometryContext &geoCtx,
       const Acts::MagneticFieldContext &magCtx, generator_t &generator,
       const Particle &particle) const {
+    SimulationResult result;
+    auto status = simulate(geoCtx, magCtx, generator, particle, result);
+    if (!status.ok()) {
+      return status.error();
+    }
+    return std::move(result);
+  }
+
+  /// Simulate a single particle without secondaries into a reused result.
+  ///
+  /// The hit and generated particle buffers of the result are cleared but
+  /// keep their capacity. Simulating many particles with the same result
+  /// thus stops allocating once the buffers are large enough.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param generator is the random number generator
+  /// @param particle is the initial particle state
+  /// @param result is overwritten with the simulated particle state, hits,
+  ///        and generated particles
+  template <typename generator_t>
+  Acts::Result<void> simulate(const Acts::GeometryContext &geoCtx,
+                              const Acts::MagneticFieldContext &magCtx,
+                              generator_t &generator, const Particle &particle,
+                              SimulationResult &result) const {
     // propagator-related additional types
     using Actor = detail::SimulationActor<generator_t, decay_t, interactions_t,
                                           hit_surface_selector_t>;
@@ -84,6 +112,11 @@ struct SingleParticleSimulation {
     using Actions = Acts::ActionList<Actor>;
     using Abort = Acts::AbortList<Aborter, Acts::EndOfWorldReached>;
     using PropagatorOptions = Acts::PropagatorOptions<Actions, Abort>;
+    using CurvilinearParameters =
+        Acts::detail::stepper_curvilinear_parameters_type_t<
+            typename propagator_t::Stepper>;
+    using PropagatorResult = typename propagator_t::template
+        action_list_t_result_t<CurvilinearParameters, Actions>;
 
     // Construct per-call options.
     PropagatorOptions options(geoCtx, magCtx);
@@ -97,23 +130,27 @@ struct SingleParticleSimulation {
     actor.selectHitSurface = selectHitSurface;
     actor.initialParticle = particle;
 
-    if (particle.hasReferenceSurface()) {
-      auto result = propagator.propagate(
-          particle.boundParameters(geoCtx).value(), options);
-      if (!result.ok()) {
-        return result.error();
-      }
-      auto &value = result.value().template get<Result>();
-      return std::move(value);
-    }
+    // hand the emptied buffers to the propagation. all other members are
+    // reset to their initial values to arm the actor for the first step.
+    PropagatorResult input;
+    auto &inputValue = input.template get<Result>();
+    inputValue.generatedParticles = std::move(result.generatedParticles);
+    inputValue.generatedParticles.clear();
+    inputValue.hits = std::move(result.hits);
+    inputValue.hits.clear();
 
-    auto result =
-        propagator.propagate(particle.curvilinearParameters(), options);
-    if (!result.ok()) {
-      return result.error();
+    // the final parameters are not needed, the particle state is in the result
+    auto propagated =
+        particle.hasReferenceSurface()
+            ? propagator.propagate(particle.boundParameters(geoCtx).value(),
+                                   options, false, std::move(input))
+            : propagator.propagate(particle.curvilinearParameters(), options,
+                                   false, std::move(input));
+    if (!propagated.ok()) {
+      return propagated.error();
     }
-    auto &value = result.value().template get<Result>();
-    return std::move(value);
+    result = std::move(propagated.value().template get<Result>());
+    return Acts::Result<void>::success();
   }
 };
 
@@ -199,9 +236,9 @@ struct Simulation {
         (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) &&
         "Inconsistent initial sizes of the simulated particle containers");
 
-    using SingleParticleSimulationResult = Acts::Result<SimulationResult>;
-
     std::vector<FailedParticle> failedParticles;
+    // reused for all particles to retain the capacity of its buffers
+    SimulationResult result;
 
     for (const Particle &inputParticle : inputParticles) {
       // only consider simulatable particles
@@ -230,24 +267,25 @@ struct Simulation {
 
         // only simulatable particles are pushed to the container and here we
         // only need to switch between charged/neutral.
-        SingleParticleSimulationResult result =
-            SingleParticleSimulationResult::success({});
+        Acts::Result<void> status = Acts::Result<void>::success();
         if (initialParticle.charge() != Particle::Scalar(0)) {
-          result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
+          status = charged.simulate(geoCtx, magCtx, generator, initialParticle,
+                                    result);
         } else {
-          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
+          status = neutral.simulate(geoCtx, magCtx, generator, initialParticle,
+                                    result);
         }
 
-        if (!result.ok()) {
+        if (!status.ok()) {
           // remove particle from output container since it was not simulated.
           simulatedParticlesInitial.erase(
               std::next(simulatedParticlesInitial.begin(), iinitial));
           // record the particle as failed
-          failedParticles.push_back({initialParticle, result.error()});
+          failedParticles.push_back({initialParticle, status.error()});
           continue;
         }
 
-        copyOutputs(result.value(), simulatedParticlesInitial,
+        copyOutputs(result, simulatedParticlesInitial,
                     simulatedParticlesFinal, hits);
         // since physics processes are independent, there can be particle id
         // collisions within the generated secondaries. they can be resolved by
@@ -291,7 +329,7 @@ struct Simulation {
         result.generatedParticles.begin(), result.generatedParticles.end(),
         std::back_inserter(particlesInitial),
         [this](const Particle &particle) { return selectParticle(particle); });
-    std::copy(result.hits.begin(), result.hits.end(), std::back_inserter(hits));
+    hits.insert(hits.end(), result.hits.begin(), result.hits.end());
   }
 
   /// Renumber particle ids in the tail of the container.
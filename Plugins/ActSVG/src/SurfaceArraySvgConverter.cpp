@@ -12,6 +12,13 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Surfaces/SurfaceArray.hpp"
 #include "Acts/Surfaces/SurfaceBounds.hpp"
+#include "Acts/Utilities/Enumerate.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <unordered_map>
+#include <utility>
 
 std::tuple<std::vector<Acts::Svg::ProtoSurfaces>, Acts::Svg::ProtoGrid,
            std::vector<Acts::Svg::ProtoAssociations> >
@@ -78,9 +85,12 @@ Acts::Svg::SurfaceArrayConverter::convert(
     pGrid._edges_1 = convertGridEdges(edges1);
   }
 
-  // Find the template surfaces & prepare template objects to be assigned
+  // Find the template surfaces & prepare template objects to be assigned,
+  // every surface is assigned to the template with equal bounds
   std::vector<actsvg::svg::object> templateObjects;
   std::vector<const SurfaceBounds*> templateBounds;
+  std::vector<std::size_t> surfaceTemplates;
+  surfaceTemplates.reserve(surfaces.size());
 
   for (const auto& sf : surfaces) {
     // Get bounds and check them
@@ -110,27 +120,53 @@ Acts::Svg::SurfaceArrayConverter::convert(
                    "Template_" + std::to_string(templateObjects.size()));
       templateBounds.push_back(&sBounds);
       templateObjects.push_back(referenceObject);
+      tBounds = std::prev(templateBounds.end());
     }
+    surfaceTemplates.push_back(std::distance(templateBounds.begin(), tBounds));
   }
 
+  // Converted template surfaces only depend on the bounds and the style, they
+  // are converted once and copied for all surfaces sharing them
+  std::map<std::pair<std::size_t, const Style*>, ProtoSurface> pTemplates;
+
   // Estimate a reference radius
   ActsScalar radius = 0.;
 
   // Now draw the surfaces from the correct template
-  for (const auto& sf : surfaces) {
+  for (const auto [isf, sf] : enumerate(surfaces)) {
     radius += Acts::VectorHelpers::perp(sf->center(gctx));
 
     // Let's get the right style
     SurfaceConverter::Options sOptions;
     sOptions.templateSurface = vType != cylinder;
     // Find a corresponding file in the playbook
+    const Style* style = nullptr;
     auto sfStyle = cOptions.surfaceStyles.find(sf->geometryId());
     if (sfStyle != cOptions.surfaceStyles.end()) {
       sOptions.style = *sfStyle;
+      style = &(*sfStyle);
     }
 
     // Convert the surface from ACTS to actsvg
-    auto cSurface = Acts::Svg::SurfaceConverter::convert(gctx, *sf, sOptions);
+    ProtoSurface cSurface;
+    if (sOptions.templateSurface) {
+      auto key = std::make_pair(surfaceTemplates[isf], style);
+      auto pTemplate = pTemplates.find(key);
+      if (pTemplate == pTemplates.end()) {
+        pTemplate =
+            pTemplates
+                .emplace(key, SurfaceConverter::convert(gctx, *sf, sOptions))
+                .first;
+      }
+      cSurface = pTemplate->second;
+      // The z position is the only placement information of a template
+      if (sf->bounds().type() == SurfaceBounds::BoundsType::eDisc) {
+        actsvg::scalar zp = static_cast<actsvg::scalar>(sf->center(gctx).z());
+        cSurface._zparameters = {zp, zp};
+      }
+    } else {
+      cSurface = Acts::Svg::SurfaceConverter::convert(gctx, *sf, sOptions);
+    }
     cSurface._name = "Module_n_" + std::to_string(pSurfaces.size());
 
     cSurface._aux_info["grid_info"] = {
@@ -138,19 +174,7 @@ Acts::Svg::SurfaceArrayConverter::convert(
         ", surface = " + std::to_string(sf->geometryId().sensitive())};
     // Assign the template for cylinder layers
     if (vType == cylinder) {
-      const SurfaceBounds& sBounds = sf->bounds();
-      // Helper to find bounds
-      auto sameBounds = [&](const SurfaceBounds* test) {
-        return ((*test) == sBounds);
-      };
-      // Check if you have this template object already
-      auto tBounds = std::find_if(templateBounds.begin(), templateBounds.end(),
-                                  sameBounds);
-      // New reference bounds and new reference object
-      if (tBounds != templateBounds.end()) {
-        std::size_t tObject = std::distance(templateBounds.begin(), tBounds);
-        cSurface._template_object = templateObjects[tObject];
-      }
+      cSurface._template_object = templateObjects[surfaceTemplates[isf]];
     }
     // Correct view transform for disc/planar layers
     if (vType == planar || vType == polar) {
@@ -172,11 +196,16 @@ Acts::Svg::SurfaceArrayConverter::convert(
       cSurface._transform._rot = {static_cast<actsvg::scalar>(alpha), 0., 0.};
     }
 
-    pSurfaces.push_back(cSurface);
+    pSurfaces.push_back(std::move(cSurface));
   }
   radius /= surfaces.size();
 
   // Create the bin associations
+  std::unordered_map<const Surface*, std::size_t> surfaceIndices;
+  surfaceIndices.reserve(surfaces.size());
+  for (const auto [isf, sf] : enumerate(surfaces)) {
+    surfaceIndices.emplace(sf, isf);
+  }
   for (unsigned int il0 = 1; il0 < pGrid._edges_0.size(); ++il0) {
     ActsScalar p0 = 0.5 * (pGrid._edges_0[il0] + pGrid._edges_0[il0 - 1]);
     for (unsigned int il1 = 1; il1 < pGrid._edges_1.size(); ++il1) {
@@ -192,9 +221,9 @@ Acts::Svg::SurfaceArrayConverter::convert(
       auto bSurfaces = surfaceArray.neighbors(bCenter);
       std::vector<std::size_t> binnAssoc;
       for (const auto& bs : bSurfaces) {
-        auto candidate = std::find(surfaces.begin(), surfaces.end(), bs);
-        if (candidate != surfaces.end()) {
-          binnAssoc.push_back(std::distance(surfaces.begin(), candidate));
+        auto candidate = surfaceIndices.find(bs);
+        if (candidate != surfaceIndices.end()) {
+          binnAssoc.push_back(candidate->second);
         }
       }
       pAssociations.push_back(binnAssoc);
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include "Acts/Definitions/Algebra.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 
+#include <array>
+#include <cstddef>
 #include <memory>
 
 namespace dd4hep {
@@ -22,8 +25,29 @@ class DD4hepFieldAdapter : public Acts::MagneticFieldProvider {
   struct Cache {};
 
  public:
+  /// Region and granularity of the tabulated field
+  struct Tabulation {
+    /// Lower corner of the tabulated region
+    Vector3 min = Vector3::Zero();
+    /// Upper corner of the tabulated region
+    Vector3 max = Vector3::Zero();
+    /// Number of grid points along x, y and z, including both corners
+    std::array<std::size_t, 3> nPoints = {2, 2, 2};
+  };
+
   DD4hepFieldAdapter(dd4hep::OverlayedField field);
 
+  /// Construct the adapter with a tabulated field.
+  ///
+  /// The DD4hep field is sampled once on a regular grid and interpolated
+  /// within the tabulated region, using the cell cache of the interpolated
+  /// field map. Outside of the region, the DD4hep field is queried directly.
+  ///
+  /// @param field is the DD4hep field
+  /// @param tabulation is the region and granularity of the grid
+  DD4hepFieldAdapter(dd4hep::OverlayedField field,
+                     const Tabulation& tabulation);
+
   MagneticFieldProvider::Cache makeCache(
       const Acts::MagneticFieldContext& mctx) const override;
 
@@ -35,9 +59,16 @@ class DD4hepFieldAdapter : public Acts::MagneticFieldProvider {
       MagneticFieldProvider::Cache& cache) const override;
 
  private:
+  /// Query the DD4hep field directly
+  Vector3 getDD4hepField(const Vector3& position) const;
+
   double m_fieldConversionFactor;
   double m_lengthConversionFactor;
   std::unique_ptr<dd4hep::OverlayedField> m_field;
+
+  /// The tabulated field, not set if not tabulated
+  std::unique_ptr<const MagneticFieldProvider> m_tabulatedField;
+  Tabulation m_tabulation;
 };
 
 }  // namespace Acts
@@ -10,9 +10,16 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldError.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Utilities/Grid.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+
+#include <stdexcept>
+#include <vector>
 
 #include <DD4hep/Fields.h>
 #include <DD4hep/Handle.h>
@@ -28,13 +35,70 @@ DD4hepFieldAdapter::DD4hepFieldAdapter(dd4hep::OverlayedField field)
       dd4hep::_toDouble("1*mm") / Acts::UnitConstants::mm;
 }
 
+DD4hepFieldAdapter::DD4hepFieldAdapter(dd4hep::OverlayedField field,
+                                       const Tabulation& tabulation)
+    : DD4hepFieldAdapter(field) {
+  for (std::size_t i = 0; i < 3; ++i) {
+    if (tabulation.nPoints[i] < 2 || !(tabulation.min[i] < tabulation.max[i])) {
+      throw std::invalid_argument(
+          "DD4hepFieldAdapter: invalid tabulation region");
+    }
+  }
+  m_tabulation = tabulation;
+
+  // Sample the field at the grid points, x is the outermost dimension
+  std::array<std::vector<double>, 3> positions;
+  for (std::size_t i = 0; i < 3; ++i) {
+    const double step = (tabulation.max[i] - tabulation.min[i]) /
+                        (tabulation.nPoints[i] - 1);
+    for (std::size_t j = 0; j < tabulation.nPoints[i]; ++j) {
+      positions[i].push_back(tabulation.min[i] + j * step);
+    }
+  }
+  std::vector<Vector3> values;
+  values.reserve(tabulation.nPoints[0] * tabulation.nPoints[1] *
+                 tabulation.nPoints[2]);
+  for (double x : positions[0]) {
+    for (double y : positions[1]) {
+      for (double z : positions[2]) {
+        values.push_back(getDD4hepField(Vector3(x, y, z)));
+      }
+    }
+  }
+
+  auto localToGlobalBin = [](std::array<std::size_t, 3> binsXYZ,
+                             std::array<std::size_t, 3> nBinsXYZ) {
+    return (binsXYZ[0] * (nBinsXYZ[1] * nBinsXYZ[2]) +
+            binsXYZ[1] * nBinsXYZ[2] + binsXYZ[2]);
+  };
+  using FieldMap = InterpolatedBFieldMap<
+      Grid<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+           detail::EquidistantAxis>>;
+  m_tabulatedField = std::make_unique<const FieldMap>(
+      fieldMapXYZ(localToGlobalBin, positions[0], positions[1], positions[2],
+                  std::move(values), 1., 1.));
+}
+
 MagneticFieldProvider::Cache DD4hepFieldAdapter::makeCache(
-    const Acts::MagneticFieldContext& /*mctx*/) const {
+    const Acts::MagneticFieldContext& mctx) const {
+  if (m_tabulatedField) {
+    return m_tabulatedField->makeCache(mctx);
+  }
   return MagneticFieldProvider::Cache::make<Cache>();
 }
 
 Result<Vector3> DD4hepFieldAdapter::getField(
-    const Vector3& position, MagneticFieldProvider::Cache& /*cache*/) const {
+    const Vector3& position, MagneticFieldProvider::Cache& cache) const {
+  // The field map excludes its upper boundary, which is queried directly
+  if (m_tabulatedField &&
+      (m_tabulation.min.array() <= position.array()).all() &&
+      (position.array() < m_tabulation.max.array()).all()) {
+    return m_tabulatedField->getField(position, cache);
+  }
+  return Result<Vector3>::success(getDD4hepField(position));
+}
+
+Vector3 DD4hepFieldAdapter::getDD4hepField(const Vector3& position) const {
   dd4hep::Position dd4hepPosition{position.x(), position.y(), position.z()};
 
   // ACTS mm -> dd4hep mm
@@ -47,7 +111,7 @@ Result<Vector3> DD4hepFieldAdapter::getField(
   // dd4hep tesla -> ACTS tesla
   result *= m_fieldConversionFactor;
 
-  return Result<Vector3>::success(result);
+  return result;
 }
 
 Result<Vector3> DD4hepFieldAdapter::getFieldGradient(
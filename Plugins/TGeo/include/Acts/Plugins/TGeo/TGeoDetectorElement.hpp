@@ -116,6 +116,11 @@ class TGeoDetectorElement : public IdentifiedDetectorElement {
   /// @param gctx The current geometry context object, e.g. alignment
   const Transform3& transform(const GeometryContext& gctx) const override;
 
+  /// Return the cached global to local transform
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  Transform3 inverseTransform(const GeometryContext& gctx) const override;
+
   /// Return surface associated with this detector element
   const Surface& surface() const override;
 
@@ -141,6 +146,8 @@ class TGeoDetectorElement : public IdentifiedDetectorElement {
   const TGeoNode* m_detElement{nullptr};
   /// Transformation of the detector element
   Transform3 m_transform = Transform3::Identity();
+  /// Inverse transformation of the detector element
+  Transform3 m_inverseTransform = Transform3::Identity();
   /// Identifier of the detector element
   Identifier m_identifier;
   /// Boundaries of the detector element
@@ -160,6 +167,11 @@ inline const Transform3& TGeoDetectorElement::transform(
   return m_transform;
 }
 
+inline Transform3 TGeoDetectorElement::inverseTransform(
+    const GeometryContext& /*gctx*/) const {
+  return m_inverseTransform;
+}
+
 inline const Surface& TGeoDetectorElement::surface() const {
   return (*m_surface);
 }
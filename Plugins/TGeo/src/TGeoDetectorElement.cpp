@@ -85,6 +85,7 @@ Acts::TGeoDetectorElement::TGeoDetectorElement(
   if (m_surface != nullptr) {
     m_surface->assignSurfaceMaterial(std::move(material));
   }
+  m_inverseTransform = m_transform.inverse(Eigen::Isometry);
 }
 
 Acts::TGeoDetectorElement::TGeoDetectorElement(
@@ -94,6 +95,7 @@ Acts::TGeoDetectorElement::TGeoDetectorElement(
     : Acts::IdentifiedDetectorElement(),
       m_detElement(&tGeoNode),
       m_transform(tgTransform),
+      m_inverseTransform(tgTransform.inverse(Eigen::Isometry)),
       m_identifier(identifier),
       m_bounds(tgBounds),
       m_thickness(tgThickness) {
@@ -107,6 +109,7 @@ Acts::TGeoDetectorElement::TGeoDetectorElement(
     : Acts::IdentifiedDetectorElement(),
       m_detElement(&tGeoNode),
       m_transform(tgTransform),
+      m_inverseTransform(tgTransform.inverse(Eigen::Isometry)),
       m_identifier(identifier),
       m_bounds(tgBounds),
       m_thickness(tgThickness) {
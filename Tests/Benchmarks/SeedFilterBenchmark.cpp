@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SpacePointData.hpp"
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+struct SpacePoint {
+  float m_x;
+  float m_y;
+  float m_z;
+  float x() const { return m_x; }
+  float y() const { return m_y; }
+  float z() const { return m_z; }
+  float varianceR() const { return 0; }
+  float varianceZ() const { return 0; }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Acts::Logging::INFO;
+  unsigned int nTops = 1;
+  unsigned int nLayers = 1;
+  float spread = 0;
+  unsigned int nOuter = 0;
+  unsigned int runs = 1;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("tops",po::value<unsigned int>(&nTops)->default_value(200),"number of top space point candidates for the middle space point")
+      ("layers",po::value<unsigned int>(&nLayers)->default_value(2),"number of layers the top space points are distributed on")
+      ("spread",po::value<float>(&spread)->default_value(2),"radial spread of the top space points of a layer in mm")
+      ("outer",po::value<unsigned int>(&nOuter)->default_value(0),"number of top space points on an additional sparse outer layer, few of them next to a dense layer are the worst case for the compatible seed search")
+      ("runs",po::value<unsigned int>(&runs)->default_value(1000),"number of benchmark runs")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("SeedFilter", Acts::Logging::Level(lvl)));
+
+  SeedFilterConfig config;
+  config.maxSeedsPerSpM = 5;
+  config = config.toInternalUnits();
+  SeedFilter<SpacePoint> seedFilter(config);
+
+  // the bottom and middle space points come first, followed by the tops which
+  // are spread over a few layers with a radial smearing, optionally with a few
+  // of them on an additional outer layer
+  std::minstd_rand rng(42);
+  std::uniform_real_distribution<float> uniform(0, 1);
+  std::uniform_int_distribution<unsigned int> layer(0, nLayers - 1);
+  const std::size_t nSpacePoints = nTops + 2;
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(nSpacePoints);
+  spacePoints.push_back({30_mm, 0, 0});
+  spacePoints.push_back({70_mm, 0, 0});
+  for (std::size_t i = 0; i < nTops; ++i) {
+    const unsigned int l = i < nOuter ? nLayers : layer(rng);
+    const float r = 120_mm + 60_mm * l + spread * uniform(rng);
+    const float phi = 0.05 * uniform(rng);
+    const float z = 500_mm * uniform(rng);
+    spacePoints.push_back({r * std::cos(phi), r * std::sin(phi), z});
+  }
+  std::vector<InternalSpacePoint<SpacePoint>> internalSpacePoints;
+  internalSpacePoints.reserve(nSpacePoints);
+  for (std::size_t i = 0; i < nSpacePoints; ++i) {
+    const SpacePoint& sp = spacePoints[i];
+    internalSpacePoints.emplace_back(i, sp, Vector3(sp.x(), sp.y(), sp.z()),
+                                     Vector2(0, 0), Vector2(0, 0));
+  }
+  SpacePointData spacePointData;
+  spacePointData.resize(nSpacePoints);
+
+  std::vector<const InternalSpacePoint<SpacePoint>*> topSpVec;
+  std::vector<float> invHelixDiameterVec;
+  std::vector<float> impactParametersVec;
+  for (std::size_t i = 2; i < nSpacePoints; ++i) {
+    topSpVec.push_back(&internalSpacePoints[i]);
+    invHelixDiameterVec.push_back(1e-4 * uniform(rng));
+    impactParametersVec.push_back(uniform(rng));
+  }
+
+  const auto& bottomSP = internalSpacePoints[0];
+  const auto& middleSP = internalSpacePoints[1];
+  CandidatesForMiddleSp<const InternalSpacePoint<SpacePoint>> candidates;
+  candidates.setMaxElements(config.maxSeedsPerSpM + 1, 0);
+
+  const auto filter_benchmark = Acts::Test::microBenchmark(
+      [&] {
+        SeedFilterState state;
+        candidates.clear();
+        seedFilter.filterSeeds_2SpFixed(
+            spacePointData, bottomSP, middleSP, topSpVec, invHelixDiameterVec,
+            impactParametersVec, state, candidates);
+        return state.numSeeds;
+      },
+      1, runs);
+
+  ACTS_INFO("Execution stats for " << nTops << " top space points on "
+                                   << nLayers << " layers with " << spread
+                                   << " mm spread and " << nOuter
+                                   << " on the outer layer: "
+                                   << filter_benchmark);
+}
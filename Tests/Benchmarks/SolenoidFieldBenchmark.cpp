@@ -88,6 +88,25 @@ int main(int argc, char* argv[]) {
   std::cout << solenoid_result << std::endl;
   csv("solenoid", solenoid_result);
 
+  // The tabulated SolenoidBField serves lookups inside its region from an
+  // interpolation table, so it is benchmarked like the interpolated map.
+  std::cout << "Building tabulated SolenoidBField" << std::endl;
+  Acts::SolenoidBField::Config tabulatedConfig{R, L, nCoils, bMagCenter};
+  tabulatedConfig.tabulationTolerance = 1e-2_T;
+  tabulatedConfig.tabulationRMax = R * 1.5;
+  tabulatedConfig.tabulationZMax = L * 0.75;
+  Acts::SolenoidBField bSolenoidFieldTabulated(tabulatedConfig);
+  std::cout << "Tabulation error: "
+            << bSolenoidFieldTabulated.tabulationError() / 1_T << " T"
+            << std::endl;
+
+  std::cout << "Benchmarking random tabulated SolenoidBField lookup: "
+            << std::flush;
+  const auto solenoid_tab_result = Acts::Test::microBenchmark(
+      [&] { return bSolenoidFieldTabulated.getField(genPos()); }, iters_map);
+  std::cout << solenoid_tab_result << std::endl;
+  csv("solenoid_tabulated", solenoid_tab_result);
+
   // ...but for interpolated B-field map, the overhead of a field lookup is
   // comparable to that of generating a random position, so we must be more
   // careful. Hence we do two microbenchmarks which represent a kind of
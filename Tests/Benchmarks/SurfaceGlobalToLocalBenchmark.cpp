@@ -0,0 +1,106 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/ConeSurface.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <iostream>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+unsigned int nrepts = 100000;
+
+GeometryContext tgContext = GeometryContext();
+
+// Some random rigid-body transform
+Transform3 at = Transform3::Identity() * Translation3(0_m, 0_m, 10_m) *
+                AngleAxis3(0.15, Vector3(1.2, 1.2, 0.12).normalized());
+
+auto aPlane = Surface::makeShared<PlaneSurface>(
+    at, std::make_shared<RectangleBounds>(1_m, 1_m));
+auto aDisc = Surface::makeShared<DiscSurface>(
+    at, std::make_shared<RadialBounds>(0.2_m, 1.2_m));
+auto aCylinder = Surface::makeShared<CylinderSurface>(
+    at, std::make_shared<CylinderBounds>(10_m, 100_m));
+auto aCone = Surface::makeShared<ConeSurface>(at, 0.3, -2_m, 2_m);
+auto aStraw = Surface::makeShared<StrawSurface>(at, 50_cm, 2_m);
+
+Vector3 direction = Vector3(0.1, 0.2, 0.9).normalized();
+
+// Put the position on the surface, so the conversions succeed
+Vector3 onSurface(const Surface& surface, const Vector2& local) {
+  return surface.localToGlobal(tgContext, local, direction);
+}
+
+template <typename surface_t>
+MicroBenchmarkResult globalToLocalTest(const surface_t& surface,
+                                       const Vector2& local) {
+  const Vector3 position = onSurface(surface, local);
+  return Acts::Test::microBenchmark(
+      [&] { return surface.globalToLocal(tgContext, position, direction); },
+      nrepts);
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_inverse_transform) {
+  const Vector3 position(1_m, 2_m, 3_m);
+  std::cout << "- General affine inverse: "
+            << Acts::Test::microBenchmark(
+                   [&] {
+                     return Vector3(aPlane->transform(tgContext).inverse() *
+                                    position);
+                   },
+                   nrepts)
+            << std::endl;
+  std::cout << "- Rigid-body inverse: "
+            << Acts::Test::microBenchmark(
+                   [&] {
+                     return Vector3(aPlane->transform(tgContext).inverse(
+                                        Eigen::Isometry) *
+                                    position);
+                   },
+                   nrepts)
+            << std::endl;
+  std::cout << "- Cached inverse: "
+            << Acts::Test::microBenchmark(
+                   [&] {
+                     return Vector3(aPlane->inverseTransform(tgContext) *
+                                    position);
+                   },
+                   nrepts)
+            << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_surface_global_to_local) {
+  std::cout << "- Plane: "
+            << globalToLocalTest(*aPlane, Vector2(10_cm, 20_cm)) << std::endl;
+  std::cout << "- Disc: " << globalToLocalTest(*aDisc, Vector2(50_cm, 0.2))
+            << std::endl;
+  std::cout << "- Cylinder: "
+            << globalToLocalTest(*aCylinder, Vector2(1_m, 20_cm)) << std::endl;
+  std::cout << "- Cone: " << globalToLocalTest(*aCone, Vector2(0.2, 1_m))
+            << std::endl;
+  std::cout << "- Straw: " << globalToLocalTest(*aStraw, Vector2(10_cm, 1_m))
+            << std::endl;
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -11,6 +11,7 @@
 #include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/Utilities/Zip.hpp"
 
+#include <functional>
 #include <numeric>
 
 using namespace Acts;
@@ -182,4 +183,174 @@ BOOST_AUTO_TEST_CASE(ReverseTrackStates) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(AppendTrackStatesInBulk) {
+  using PM = TrackStatePropMask;
+
+  VectorMultiTrajectory src{};
+  src.addColumn<std::size_t>("counter");
+
+  // a branching sequence: two tips sharing the first two track states
+  IndexType previous = kTrackIndexInvalid;
+  std::vector<IndexType> indices;
+  for (std::size_t i = 0; i < 4; i++) {
+    IndexType iprevious = i == 3 ? indices.at(1) : previous;
+    auto ts = src.getTrackState(src.addTrackState(PM::All, iprevious));
+    ts.predicted() = BoundVector::Ones() * (i + 1);
+    ts.filtered() = BoundVector::Ones() * (i + 10);
+    ts.jacobian() = BoundMatrix::Identity() * (i + 1);
+    ts.chi2() = i;
+    ts.template component<std::size_t>("counter") = i;
+    if (i % 2 == 0) {
+      ts.allocateCalibrated(2);
+      ts.template calibrated<2>() = Vector2::Ones() * i;
+      ts.template calibratedCovariance<2>() = SquareMatrix2::Identity() * i;
+    } else {
+      // outlier like state sharing the predicted parameters
+      ts.shareFrom(PM::Predicted, PM::Filtered);
+    }
+    previous = ts.index();
+    indices.push_back(ts.index());
+  }
+
+  VectorMultiTrajectory dst{};
+  dst.addColumn<std::size_t>("counter");
+  // existing content must not be touched
+  dst.addTrackState();
+
+  auto check = [&](IndexType srcTip, std::pair<IndexType, IndexType> result,
+                   std::size_t expected) {
+    auto [stem, tip] = result;
+    BOOST_CHECK_EQUAL(dst.getTrackState(stem).previous(), kTrackIndexInvalid);
+
+    // forward links match the backward links
+    std::size_t n = 0;
+    IndexType last = kTrackIndexInvalid;
+    for (IndexType i = stem; i != kTrackIndexInvalid;
+         i = dst.getTrackState(i).template component<IndexType>("next"_hash)) {
+      BOOST_CHECK_EQUAL(dst.getTrackState(i).previous(), last);
+      last = i;
+      n++;
+    }
+    BOOST_CHECK_EQUAL(last, tip);
+    BOOST_CHECK_EQUAL(n, expected);
+
+    IndexType isrc = srcTip;
+    IndexType idst = tip;
+    for (std::size_t j = 0; j < expected; j++) {
+      auto a = src.getTrackState(isrc);
+      auto b = dst.getTrackState(idst);
+      BOOST_CHECK_EQUAL(a.predicted(), b.predicted());
+      BOOST_CHECK_EQUAL(a.filtered(), b.filtered());
+      BOOST_CHECK_EQUAL(a.jacobian(), b.jacobian());
+      BOOST_CHECK_EQUAL(a.chi2(), b.chi2());
+      BOOST_CHECK_EQUAL(a.template component<std::size_t>("counter"),
+                        b.template component<std::size_t>("counter"));
+      BOOST_CHECK_EQUAL(a.hasCalibrated(), b.hasCalibrated());
+      if (a.hasCalibrated()) {
+        BOOST_CHECK_EQUAL(a.template calibrated<2>(),
+                          b.template calibrated<2>());
+        BOOST_CHECK_EQUAL(a.template calibratedCovariance<2>(),
+                          b.template calibratedCovariance<2>());
+      } else {
+        // sharing is preserved
+        b.filtered() *= 2;
+        BOOST_CHECK_EQUAL(b.predicted(), b.filtered());
+      }
+      isrc = a.previous();
+      idst = b.previous();
+    }
+  };
+
+  check(indices.at(2), dst.appendTrackStates(src, indices.at(2)), 3);
+  check(indices.at(3), dst.appendTrackStates(src, indices.at(3)), 3);
+  BOOST_CHECK_EQUAL(dst.size(), 7);
+
+  auto [stem, tip] = dst.appendTrackStates(src, kTrackIndexInvalid);
+  BOOST_CHECK_EQUAL(stem, kTrackIndexInvalid);
+  BOOST_CHECK_EQUAL(tip, kTrackIndexInvalid);
+  BOOST_CHECK_EQUAL(dst.size(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(PackedCovariances) {
+  using PM = TrackStatePropMask;
+  using Storage = ConstVectorMultiTrajectory::CovarianceStorage;
+
+  auto randomCovariance = []() -> BoundMatrix {
+    BoundMatrix cov = BoundMatrix::Random();
+    return cov + cov.transpose();
+  };
+
+  VectorMultiTrajectory mtj{};
+  IndexType previous = kTrackIndexInvalid;
+  for (std::size_t i = 0; i < 4; i++) {
+    auto ts = mtj.getTrackState(mtj.addTrackState(PM::All, previous));
+    ts.predicted() = BoundVector::Random();
+    ts.predictedCovariance() = randomCovariance();
+    ts.filtered() = BoundVector::Random();
+    ts.filteredCovariance() = randomCovariance();
+    ts.smoothed() = BoundVector::Random();
+    ts.smoothedCovariance() = randomCovariance();
+    ts.jacobian() = BoundMatrix::Random();
+    if (i % 2 == 1) {
+      ts.shareFrom(PM::Predicted, PM::Filtered);
+    }
+    if (i == 0) {
+      ts.unset(PM::Smoothed);
+    }
+    previous = ts.index();
+  }
+
+  for (Storage storage :
+       {Storage::Full, Storage::Packed, Storage::PackedFloat}) {
+    BOOST_TEST_CONTEXT("Storage " << static_cast<int>(storage)) {
+      VectorMultiTrajectory copy = mtj;
+      ConstVectorMultiTrajectory packed{std::move(copy), storage};
+      BOOST_CHECK(packed.covarianceStorage() == storage);
+      ConstVectorMultiTrajectory packedCopy = packed;
+      BOOST_CHECK(packedCopy.covarianceStorage() == storage);
+      // the content is only rounded with reduced precision
+      auto checkCovariance = [&](const auto& a, const auto& b) {
+        if (storage == Storage::PackedFloat) {
+          BOOST_CHECK(a.isApprox(b, 1e-6));
+        } else {
+          BOOST_CHECK_EQUAL(a, b);
+        }
+      };
+
+      for (IndexType i = 0; i < mtj.size(); i++) {
+        auto ref = mtj.getTrackState(i);
+        for (const auto& ctj : {std::cref(packed), std::cref(packedCopy)}) {
+          auto ts = ctj.get().getTrackState(i);
+          BOOST_CHECK_EQUAL(ts.getMask(), ref.getMask());
+          BOOST_CHECK_EQUAL(ts.predicted(), ref.predicted());
+          checkCovariance(ts.predictedCovariance(), ref.predictedCovariance());
+          BOOST_CHECK_EQUAL(ts.filtered(), ref.filtered());
+          checkCovariance(ts.filteredCovariance(), ref.filteredCovariance());
+          BOOST_REQUIRE_EQUAL(ts.hasSmoothed(), ref.hasSmoothed());
+          if (ref.hasSmoothed()) {
+            BOOST_CHECK_EQUAL(ts.smoothed(), ref.smoothed());
+            checkCovariance(ts.smoothedCovariance(), ref.smoothedCovariance());
+          }
+          BOOST_CHECK_EQUAL(ts.jacobian(), ref.jacobian());
+          // the expanded covariances stay in place
+          BOOST_CHECK_EQUAL(ts.predictedCovariance().data(),
+                            ctj.get()
+                                .getTrackState(i)
+                                .predictedCovariance()
+                                .data());
+        }
+      }
+
+      // appending from packed storage expands the covariances again
+      VectorMultiTrajectory unpacked{};
+      unpacked.appendTrackStates(packed, previous);
+      BOOST_REQUIRE_EQUAL(unpacked.size(), mtj.size());
+      for (IndexType i = 0; i < mtj.size(); i++) {
+        checkCovariance(unpacked.getTrackState(i).filteredCovariance(),
+                        mtj.getTrackState(i).filteredCovariance());
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
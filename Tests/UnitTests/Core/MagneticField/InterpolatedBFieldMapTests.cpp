@@ -171,5 +171,73 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(c.isInside(transformPos((pos << 0, 2, -4.7).finished())));
   BOOST_CHECK(!c.isInside(transformPos((pos << 5, 2, 14.).finished())));
 }
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_mirror) {
+  // definition of a dummy BField with the symmetries of a solenoid field
+  struct BField {
+    static Vector3 value(const Vector3& pos) {
+      // multilinear in x, y and z so interpolation should be exact
+      return Vector3(pos.x() * pos.z(), pos.y() * pos.z(), 2.);
+    }
+  };
+
+  auto transformPos = [](const Vector3& pos) { return pos; };
+  auto transformBField = [](const Vector3& field, const Vector3&) {
+    return field;
+  };
+
+  // magnetic field known on the first octant only
+  detail::EquidistantAxis x(0.0, 4.0, 4u);
+  detail::EquidistantAxis y(0.0, 4.0, 4u);
+  detail::EquidistantAxis z(0.0, 6.0, 3u);
+
+  using Grid_t = Grid<Vector3, detail::EquidistantAxis,
+                      detail::EquidistantAxis, detail::EquidistantAxis>;
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  Grid_t g(std::make_tuple(std::move(x), std::move(y), std::move(z)));
+  for (std::size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      for (std::size_t k = 1; k <= g.numLocalBins().at(2) + 1; ++k) {
+        Grid_t::index_t indices = {{i, j, k}};
+        const auto& llCorner = g.lowerLeftBinEdge(indices);
+        g.atLocalBins(indices) =
+            BField::value(Vector3(llCorner[0], llCorner[1], llCorner[2]));
+      }
+    }
+  }
+
+  BField_t::Config cfg{transformPos, transformBField, std::move(g)};
+  cfg.mirror = {Vector3(-1, 1, 1), Vector3(1, -1, 1), Vector3(-1, -1, 1)};
+  BField_t b(std::move(cfg));
+
+  // the domain is reported for the unfolded grid
+  BOOST_CHECK(b.getNBins() == std::vector<std::size_t>({7u, 7u, 5u}));
+  BOOST_CHECK(b.getMin() == std::vector<double>({-3., -3., -4.}));
+  BOOST_CHECK(b.getMax() == std::vector<double>({3., 3., 4.}));
+  BOOST_CHECK(b.isInside({-3, -3, -4}));
+  BOOST_CHECK(!b.isInside({-3.1, 0, 0}));
+  BOOST_CHECK(!b.isInside({0, 0, 4}));
+
+  auto bCacheAny = b.makeCache(mfContext);
+  for (double sx : {1., -1.}) {
+    for (double sy : {1., -1.}) {
+      for (double sz : {1., -1.}) {
+        for (const Vector3 pos :
+             {Vector3(0.5, 0.7, 0.9), Vector3(2.2, 1.3, 3.7)}) {
+          Vector3 mirrored = pos.cwiseProduct(Vector3(sx, sy, sz));
+          BOOST_CHECK(b.isInside(mirrored));
+          CHECK_CLOSE_REL(b.getField(mirrored).value(),
+                          BField::value(mirrored), 1e-6);
+          CHECK_CLOSE_REL(b.getFieldUnchecked(mirrored),
+                          BField::value(mirrored), 1e-6);
+          // the cached field cell is renewed when the octant changes
+          CHECK_CLOSE_REL(b.getField(mirrored, bCacheAny).value(),
+                          BField::value(mirrored), 1e-6);
+        }
+      }
+    }
+  }
+}
 }  // namespace Test
 }  // namespace Acts
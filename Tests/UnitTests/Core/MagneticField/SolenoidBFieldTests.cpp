@@ -18,8 +18,11 @@
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cmath>
 #include <cstddef>
 #include <fstream>
+#include <random>
+#include <stdexcept>
 
 using namespace Acts::UnitLiterals;
 
@@ -111,5 +114,61 @@ BOOST_AUTO_TEST_CASE(TestSolenoidBField) {
   // outf.close();
 }
 
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldTabulated) {
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  SolenoidBField::Config cfg{};
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 50;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField exactField(cfg);
+  BOOST_CHECK(!exactField.isTabulated());
+
+  cfg.tabulationTolerance = 1e-2_T;
+  cfg.tabulationRMax = 1.5 * cfg.radius;
+  cfg.tabulationZMax = cfg.length;
+  SolenoidBField bField(cfg);
+  BOOST_CHECK(bField.isTabulated());
+  BOOST_CHECK_LE(bField.tabulationError(), cfg.tabulationTolerance);
+
+  // the tabulation region without the grid and the exact field must be
+  // consistent
+  auto cache = bField.makeCache(mfContext);
+  CHECK_CLOSE_ABS(bField.getField({0, 0, 0}, cache).value(),
+                  Vector3(0, 0, 2.0_T), cfg.tabulationTolerance);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> rDist(-cfg.tabulationRMax,
+                                               cfg.tabulationRMax);
+  std::uniform_real_distribution<double> zDist(-cfg.tabulationZMax,
+                                               cfg.tabulationZMax);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  for (std::size_t i = 0; i < 1000; i++) {
+    const Vector2 rz(rDist(rng), zDist(rng));
+    BOOST_TEST_CONTEXT("r=" << rz[0] << ", z=" << rz[1]) {
+      CHECK_CLOSE_ABS(bField.getField(rz), exactField.getField(rz),
+                      2 * cfg.tabulationTolerance);
+      CHECK_CLOSE_ABS(bField.getField(rz), bField.getFieldExact(rz),
+                      2 * cfg.tabulationTolerance);
+
+      const double phi = phiDist(rng);
+      const Vector3 xyz(rz[0] * std::cos(phi), rz[0] * std::sin(phi), rz[1]);
+      CHECK_CLOSE_ABS(bField.getField(xyz, cache).value(),
+                      exactField.getField(xyz), 2 * cfg.tabulationTolerance);
+    }
+  }
+
+  // outside of the tabulated region the field is evaluated exactly
+  for (const Vector2 rz : {Vector2(2 * cfg.tabulationRMax, 0),
+                           Vector2(0, 1.5 * cfg.tabulationZMax),
+                           Vector2(-2 * cfg.tabulationRMax, -cfg.length)}) {
+    BOOST_CHECK_EQUAL(bField.getField(rz), exactField.getField(rz));
+  }
+
+  cfg.tabulationRMax = 0;
+  BOOST_CHECK_THROW(SolenoidBField{cfg}, std::invalid_argument);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -14,6 +14,8 @@
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 
+#include <cstdint>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -59,5 +61,43 @@ BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_construction_test) {
   BinnedSurfaceMaterial bsmMoveAssigned(std::move(bsmAssigned));
 }
 
+/// Test the palette storage of identical material slabs
+BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_palette_test) {
+  BinUtility xyBinning(2, -1., 1., open, binX);
+  xyBinning += BinUtility(3, -3., 3., open, binY);
+
+  MaterialSlab a(Material::fromMolarDensity(1., 2., 3., 4., 5.), 6.);
+  MaterialSlab b(Material::fromMolarDensity(2., 3., 4., 5., 6.), 7.);
+  MaterialSlab c(Material::fromMolarDensity(1., 2., 3., 4., 5.), 8.);
+
+  MaterialSlabMatrix m = {{a, b}, {b, a}, {c, a}};
+  BinnedSurfaceMaterial bsm(xyBinning, m);
+
+  // identical slabs are stored once, in the order of appearance
+  BOOST_CHECK_EQUAL(bsm.palette().size(), 3u);
+  BOOST_CHECK(bsm.indices() ==
+              std::vector<std::uint32_t>({0u, 1u, 1u, 0u, 2u, 0u}));
+  BOOST_CHECK(bsm.fullMaterial() == m);
+  BOOST_CHECK_EQUAL(bsm.materialSlab(1, 0), b);
+  BOOST_CHECK_EQUAL(bsm.materialSlab(0, 2), c);
+  BOOST_CHECK_EQUAL(&bsm.materialSlab(0, 0), &bsm.materialSlab(1, 2));
+
+  // scaling applies to all bins sharing a slab
+  bsm *= 0.5;
+  BOOST_CHECK_EQUAL(bsm.materialSlab(0, 0).thickness(), 3.f);
+  BOOST_CHECK_EQUAL(bsm.materialSlab(1, 1).thickness(), 3.f);
+  BOOST_CHECK_EQUAL(bsm.materialSlab(0, 1).thickness(), 3.5f);
+
+  // construction from a palette
+  BinnedSurfaceMaterial bsmPalette(xyBinning, {a, b},
+                                   {0u, 1u, 1u, 0u, 1u, 1u});
+  BOOST_CHECK_EQUAL(bsmPalette.materialSlab(0, 2), b);
+  BOOST_CHECK_THROW(BinnedSurfaceMaterial(xyBinning, {a, b}, {0u, 1u}),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(
+      BinnedSurfaceMaterial(xyBinning, {a, b}, {0u, 1u, 2u, 0u, 1u, 1u}),
+      std::invalid_argument);
+}
+
 }  // namespace Test
 }  // namespace Acts
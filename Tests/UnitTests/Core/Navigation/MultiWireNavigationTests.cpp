@@ -12,6 +12,8 @@
 #include "Acts/Detector/Detector.hpp"
 #include "Acts/Detector/DetectorVolume.hpp"
 #include "Acts/Detector/MultiWireStructureBuilder.hpp"
+#include "Acts/Detector/detail/GridAxisGenerators.hpp"
+#include "Acts/Navigation/MultiLayerSurfacesUpdater.hpp"
 #include "Acts/Navigation/DetectorVolumeFinders.hpp"
 #include "Acts/Navigation/NavigationState.hpp"
 #include "Acts/Navigation/NavigationStateFillers.hpp"
@@ -23,6 +25,10 @@
 #include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -96,4 +102,115 @@ BOOST_AUTO_TEST_CASE(Navigation_in_Indexed_Surfaces) {
   BOOST_CHECK_EQUAL(nState.surfaceCandidates.size(), 18u);
 }
 
+BOOST_AUTO_TEST_CASE(Navigation_in_Multi_Wire_Analytic) {
+  std::vector<std::shared_ptr<Acts::Surface>> strawSurfaces = {};
+
+  // A chamber with 8 layers of 60 tubes, placed away from the origin
+  std::size_t nSurfacesY = 8;
+  std::size_t nSurfacesX = 60;
+
+  double radius = 15.;
+  double halfZ = 250.;
+
+  Transform3 chamber(Translation3(Vector3(0., 5000., 100.)));
+
+  for (std::size_t i = 0; i < nSurfacesY; i++) {
+    for (std::size_t j = 0; j < nSurfacesX; j++) {
+      Vector3 pos(-0.5 * nSurfacesX * 2 * radius + (2 * j + 1) * radius,
+                  -0.5 * nSurfacesY * 2 * radius + (2 * i + 1) * radius, 0.);
+      strawSurfaces.push_back(Surface::makeShared<StrawSurface>(
+          chamber * Translation3(pos), radius, halfZ));
+    }
+  }
+
+  std::vector<ActsScalar> vBounds = {0.5 * nSurfacesX * 2 * radius,
+                                     0.5 * nSurfacesX * 2 * radius,
+                                     0.5 * nSurfacesY * 2 * radius, halfZ};
+
+  MultiWireStructureBuilder::Config mlCfg;
+  mlCfg.name = "Multi_Layer_With_Wires";
+  mlCfg.mlSurfaces = strawSurfaces;
+  mlCfg.transform = chamber;
+  mlCfg.mlBinning = {
+      ProtoBinning(Acts::binX, Acts::detail::AxisBoundaryType::Bound,
+                   -vBounds[0], vBounds[0], nSurfacesX, 1u),
+      ProtoBinning(Acts::binY, Acts::detail::AxisBoundaryType::Bound,
+                   -vBounds[2], vBounds[2], nSurfacesY, 1u)};
+  mlCfg.mlBounds = vBounds;
+
+  MultiWireStructureBuilder mlBuilder(mlCfg);
+  auto [volumes, portals, roots] = mlBuilder.construct(tContext);
+
+  // An inclined track entering the chamber from below
+  Vector3 position = chamber * Vector3(-100., -120., 20.);
+  Vector3 direction = Vector3(0.5, 1., 0.1).normalized();
+
+  Acts::Experimental::NavigationState nState;
+  nState.position = position;
+  nState.direction = direction;
+  nState.currentVolume = volumes.front().get();
+  nState.currentVolume->updateNavigationState(tContext, nState);
+
+  std::vector<const Surface*> candidates;
+  for (const auto& c : nState.surfaceCandidates) {
+    if (c.surface != nullptr) {
+      candidates.push_back(c.surface);
+    }
+  }
+  // Only a narrow band of the 480 tubes is tried
+  BOOST_CHECK_LT(candidates.size(), 60u);
+
+  // Every tube crossed by the track is a candidate
+  for (const auto& straw : strawSurfaces) {
+    Vector3 wire = straw->center(tContext);
+    Vector3 axis = straw->transform(tContext).rotation().col(2);
+    Vector3 normal = direction.cross(axis).normalized();
+    double distance = std::abs((wire - position).dot(normal));
+    bool ahead = (wire - position).dot(direction) > 0.;
+    if (ahead && distance < radius) {
+      BOOST_CHECK(std::find(candidates.begin(), candidates.end(),
+                            straw.get()) != candidates.end());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Navigation_in_Multi_Wire_Axis_Parallel) {
+  // A 5 x 2 grid with the cell number as the single index of each cell
+  using EqBoundEqBound =
+      Acts::Experimental::detail::GridAxisGenerators::EqBoundEqBound;
+  EqBoundEqBound aGenerator{{0., 5.}, 5, {0., 2.}, 2};
+  using GridType =
+      typename EqBoundEqBound::template grid_type<std::vector<std::size_t>>;
+  GridType grid(aGenerator());
+  for (std::size_t iy = 0; iy < 2; ++iy) {
+    for (std::size_t ix = 0; ix < 5; ++ix) {
+      grid.atLocalBins({ix + 1, iy + 1}) = {iy * 5 + ix};
+    }
+  }
+  MultiWireSurfacesUpdaterImpl<GridType> updater(std::move(grid),
+                                                 {binX, binY});
+
+  using Indices = std::vector<std::size_t>;
+  auto check = [&](std::array<ActsScalar, 2u> position,
+                   std::array<ActsScalar, 2u> direction,
+                   const Indices& expected) {
+    Indices indices = updater.crossedIndices(position, direction);
+    BOOST_CHECK_EQUAL_COLLECTIONS(indices.begin(), indices.end(),
+                                  expected.begin(), expected.end());
+  };
+
+  // Parallel to the wires, only the start cell
+  check({2.5, 0.5}, {0., 0.}, {2});
+  check({4.9, 1.9}, {0., 0.}, {9});
+  check({2.5, 3.}, {0., 0.}, {});
+
+  // Along one of the grid axes
+  check({0.5, 1.5}, {1., 0.}, {5, 6, 7, 8, 9});
+  check({3.5, 1.5}, {-0.5, 0.}, {8, 7, 6, 5});
+  check({3.5, 0.2}, {0., 1.}, {3, 8});
+  check({3.5, 1.2}, {0., -2.}, {8, 3});
+  check({-1., 0.5}, {1., 0.}, {0, 1, 2, 3, 4});
+  check({2.5, 3.}, {1., 0.}, {});
+}
+
 BOOST_AUTO_TEST_SUITE_END()
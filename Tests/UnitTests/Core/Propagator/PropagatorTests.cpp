@@ -25,6 +25,7 @@
 #include "Acts/Propagator/ActionList.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MultiTargetCollector.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
@@ -386,5 +387,85 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+BOOST_DATA_TEST_CASE(
+    multi_target_,
+    bdata::random((bdata::engine = std::mt19937(), bdata::seed = 0,
+                   bdata::distribution = std::uniform_real_distribution<double>(
+                       0.4_GeV, 10_GeV))) ^
+        bdata::random((bdata::engine = std::mt19937(), bdata::seed = 1,
+                       bdata::distribution =
+                           std::uniform_real_distribution<double>(-M_PI,
+                                                                  M_PI))) ^
+        bdata::random(
+            (bdata::engine = std::mt19937(), bdata::seed = 2,
+             bdata::distribution =
+                 std::uniform_real_distribution<double>(1.0, M_PI - 1.0))) ^
+        bdata::random((bdata::engine = std::mt19937(), bdata::seed = 3,
+                       bdata::distribution =
+                           std::uniform_int_distribution<std::uint8_t>(0, 1))) ^
+        bdata::random((bdata::engine = std::mt19937(), bdata::seed = 4,
+                       bdata::distribution =
+                           std::uniform_real_distribution<double>(-1_ns,
+                                                                  1_ns))) ^
+        bdata::xrange(ntests),
+    pT, phi, theta, charge, time, index) {
+  double dcharge = -1 + 2 * charge;
+  (void)index;
+
+  // define start parameters
+  double px = pT * cos(phi);
+  double py = pT * sin(phi);
+  double pz = pT / tan(theta);
+  double q = dcharge;
+  Vector3 pos(0, 0, 0);
+  Vector3 mom(px, py, pz);
+  /// a covariance matrix to transport
+  Covariance cov;
+  // take some major correlations (off-diagonals)
+  cov << 10_mm, 0, 0.123, 0, 0.5, 0, 0, 10_mm, 0, 0.162, 0, 0, 0.123, 0, 0.1, 0,
+      0, 0, 0, 0.162, 0, 0.1, 0, 0, 0.5, 0, 0, 0, 1. / (10_GeV), 0, 0, 0, 0, 0,
+      0, 0;
+  CurvilinearTrackParameters start(makeVector4(pos, time), mom.normalized(),
+                                   q / mom.norm(), cov,
+                                   ParticleHypothesis::pion());
+
+  // propagate to both surfaces in a single pass
+  using MultiTargetOptions =
+      PropagatorOptions<ActionList<MultiTargetCollector>,
+                        AbortList<MultiTargetReached>>;
+  MultiTargetOptions options_mt(tgContext, mfContext);
+  options_mt.pathLimit = 10_m;
+  options_mt.maxStepSize = 1_cm;
+  options_mt.actionList.get<MultiTargetCollector>().targets = {mSurface.get(),
+                                                               cSurface.get()};
+  const auto& result_mt = epropagator.propagate(start, options_mt).value();
+  const auto& mtr = result_mt.get<MultiTargetCollector::result_type>();
+  BOOST_CHECK(mtr.result.ok());
+  BOOST_REQUIRE_EQUAL(mtr.parameters.size(), 2u);
+  BOOST_CHECK_EQUAL(&mtr.parameters[0].referenceSurface(), mSurface.get());
+  BOOST_CHECK_EQUAL(&mtr.parameters[1].referenceSurface(), cSurface.get());
+
+  // compare with separate propagations to the surfaces
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = 10_m;
+  options.maxStepSize = 1_cm;
+  for (std::size_t i = 0; i < 2u; ++i) {
+    const auto& target = (i == 0) ? *mSurface : *cSurface;
+    const auto& result = epropagator.propagate(start, target, options).value();
+    CHECK_CLOSE_REL(result.endParameters->position(tgContext),
+                    mtr.parameters[i].position(tgContext), 0.001);
+    CHECK_CLOSE_REL(result.pathLength, mtr.pathLengths[i], 0.001);
+
+    BOOST_REQUIRE(mtr.parameters[i].covariance().has_value());
+    const auto& cov_1s = *(result.endParameters->covariance());
+    const auto& cov_mt = *(mtr.parameters[i].covariance());
+    for (unsigned int j = 0; j < cov_1s.rows(); j++) {
+      for (unsigned int k = 0; k < cov_1s.cols(); k++) {
+        CHECK_CLOSE_OR_SMALL(cov_1s(j, k), cov_mt(j, k), 0.001, 1e-6);
+      }
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
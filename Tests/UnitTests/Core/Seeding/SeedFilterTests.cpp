@@ -0,0 +1,173 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/SpacePointData.hpp"
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+using InternalSP = InternalSpacePoint<SpacePoint>;
+
+/// Seed weights of all top space points computed with the plain quadratic
+/// search over all compatible top space points, as done before the curvature
+/// window was introduced
+std::vector<float> referenceWeights(const SeedFilterConfig& cfg,
+                                    const SpacePointData& spacePointData,
+                                    const std::vector<const InternalSP*>& tops,
+                                    const std::vector<float>& invHelixDiameter,
+                                    const std::vector<float>& impacts) {
+  std::vector<std::size_t> order(tops.size());
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  if (tops.size() > 2) {
+    std::sort(order.begin(), order.end(),
+              [&](const std::size_t i1, const std::size_t i2) {
+                return invHelixDiameter[i1] < invHelixDiameter[i2];
+              });
+  }
+  auto topR = [&](std::size_t i) {
+    return cfg.useDeltaRorTopRadius ? spacePointData.deltaR(tops[i]->index())
+                                    : tops[i]->radius();
+  };
+
+  std::vector<float> weights(tops.size());
+  std::vector<float> compatibleSeedR;
+  for (const std::size_t i : order) {
+    compatibleSeedR.clear();
+    float weight = -(impacts[i] * cfg.impactWeightFactor);
+    for (const std::size_t j : order) {
+      if (i == j ||
+          invHelixDiameter[j] <
+              invHelixDiameter[i] - cfg.deltaInvHelixDiameter ||
+          invHelixDiameter[j] >
+              invHelixDiameter[i] + cfg.deltaInvHelixDiameter ||
+          std::abs(topR(i) - topR(j)) < cfg.deltaRMin) {
+        continue;
+      }
+      bool newCompSeed = true;
+      for (const float previousR : compatibleSeedR) {
+        if (std::abs(previousR - topR(j)) < cfg.deltaRMin) {
+          newCompSeed = false;
+          break;
+        }
+      }
+      if (newCompSeed) {
+        compatibleSeedR.push_back(topR(j));
+        weight += cfg.compatSeedWeight;
+      }
+      if (compatibleSeedR.size() >= cfg.compatSeedLimit) {
+        break;
+      }
+    }
+    if (compatibleSeedR.size() > cfg.numSeedIncrement) {
+      weight += cfg.seedWeightIncrement;
+    }
+    weights[i] = weight;
+  }
+  return weights;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(SeedFilter_compatible_seed_weights) {
+  std::mt19937 rng(42);
+  // few distinct values to get duplicated curvatures, curvature differences
+  // exactly at the window limit and radius differences exactly at deltaRMin
+  std::uniform_int_distribution<int> curvatureStep(0, 12);
+  std::uniform_int_distribution<int> radiusStep(0, 20);
+  std::uniform_int_distribution<int> impactStep(0, 4);
+  std::uniform_int_distribution<std::size_t> nTopsDist(1, 80);
+
+  const SpacePoint externalSP{0, 0, 0, 0, 0, 0, 0};
+  const InternalSP bottomSP(0, externalSP, Vector3(30, 0, 0), Vector2(0, 0),
+                            Vector2(0, 0));
+  const InternalSP middleSP(1, externalSP, Vector3(60, 0, 0), Vector2(0, 0),
+                            Vector2(0, 0));
+
+  std::size_t nChecked = 0;
+  for (std::size_t iTest = 0; iTest < 400; ++iTest) {
+    SeedFilterConfig cfg;
+    cfg.deltaInvHelixDiameter = 0.5;
+    cfg.deltaRMin = 5.;
+    cfg.compatSeedWeight = 200.;
+    cfg.impactWeightFactor = 1.;
+    cfg.compatSeedLimit = 2 + iTest % 4;
+    cfg.seedWeightIncrement = 10.;
+    cfg.numSeedIncrement = 1.;
+    cfg.useDeltaRorTopRadius = (iTest % 2 == 1);
+    cfg = cfg.toInternalUnits();
+    SeedFilter<SpacePoint> filter(cfg);
+
+    // the first tests cover the small unsorted top collections
+    const std::size_t nTops = iTest < 20 ? 1 + iTest % 3 : nTopsDist(rng);
+
+    SpacePointData spacePointData;
+    spacePointData.resize(nTops + 2);
+    std::vector<std::unique_ptr<InternalSP>> topStorage;
+    std::vector<const InternalSP*> tops;
+    std::vector<float> invHelixDiameter;
+    std::vector<float> impacts;
+    // some tests have a dense layer with few tops on an outer layer, which
+    // needs the radius search of the remaining curvature window
+    const bool denseLayer = iTest % 5 == 4;
+    for (std::size_t i = 0; i < nTops; ++i) {
+      const float r = denseLayer && i % 16 != 0
+                          ? 80. + 2.5 * (radiusStep(rng) % 2)
+                          : 80. + 2.5 * radiusStep(rng);
+      topStorage.push_back(std::make_unique<InternalSP>(
+          i + 2, externalSP, Vector3(r, 0, 0), Vector2(0, 0), Vector2(0, 0)));
+      tops.push_back(topStorage.back().get());
+      spacePointData.setDeltaR(i + 2, 2.5 * radiusStep(rng));
+      invHelixDiameter.push_back(0.25 * curvatureStep(rng));
+      impacts.push_back(0.5 * impactStep(rng));
+    }
+
+    SeedFilterState state;
+    CandidatesForMiddleSp<const InternalSP> candidates;
+    candidates.setMaxElements(nTops, nTops);
+    filter.filterSeeds_2SpFixed(spacePointData, bottomSP, middleSP, tops,
+                                invHelixDiameter, impacts, state, candidates);
+
+    const std::vector<float> expected = referenceWeights(
+        cfg, spacePointData, tops, invHelixDiameter, impacts);
+
+    std::map<const InternalSP*, float> weights;
+    for (const auto& candidate : candidates.storage()) {
+      weights[candidate.top] = candidate.weight;
+    }
+    BOOST_REQUIRE_EQUAL(weights.size(), nTops);
+    for (std::size_t i = 0; i < nTops; ++i) {
+      BOOST_CHECK_EQUAL(weights.at(tops[i]), expected[i]);
+      ++nChecked;
+    }
+  }
+  BOOST_CHECK_GT(nChecked, 400u);
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -30,6 +30,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -243,6 +244,52 @@ BOOST_FIXTURE_TEST_CASE(SurfaceArray_create, SurfaceArrayFixture) {
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(SurfaceArray_completeBinning, SurfaceArrayFixture) {
+  SrfVec brl = makeBarrel(30, 7, 2, 1);
+  std::vector<const Surface*> brlRaw = unpack_shared_vector(brl);
+
+  // a grid much finer than the modules leaves most bins empty
+  detail::Axis<detail::AxisType::Equidistant, detail::AxisBoundaryType::Closed>
+      phiAxis(-M_PI, M_PI, 97u);
+  detail::Axis<detail::AxisType::Equidistant, detail::AxisBoundaryType::Bound>
+      zAxis(-14, 14, 41u);
+
+  auto transform = [](const Vector3& pos) {
+    return Vector2(phi(pos), pos.z());
+  };
+  auto itransform = [](const Vector2& loc) {
+    return Vector3(10 * std::cos(loc[0]), 10 * std::sin(loc[0]), loc[1]);
+  };
+
+  SurfaceArray::SurfaceGridLookup<decltype(phiAxis), decltype(zAxis)> sl(
+      transform, itransform,
+      std::make_tuple(std::move(phiAxis), std::move(zAxis)));
+  sl.fill(tgContext, brlRaw);
+  std::vector<std::size_t> emptyBins;
+  for (std::size_t b = 0; b < sl.size(); ++b) {
+    if (sl.isValidBin(b) && sl.lookup(b).empty()) {
+      emptyBins.push_back(b);
+    }
+  }
+  BOOST_CHECK_EQUAL(sl.completeBinning(tgContext, brlRaw), emptyBins.size());
+
+  // compare with the closest surface found by brute force
+  for (std::size_t b : emptyBins) {
+    BOOST_REQUIRE_EQUAL(sl.lookup(b).size(), 1u);
+    Vector3 binCtr = sl.getBinCenter(b);
+    double minPath = std::numeric_limits<double>::max();
+    const Surface* minSrf = nullptr;
+    for (const auto& srf : brlRaw) {
+      double curPath = (binCtr - srf->binningPosition(tgContext, binR)).norm();
+      if (curPath < minPath) {
+        minPath = curPath;
+        minSrf = srf;
+      }
+    }
+    BOOST_CHECK_EQUAL(sl.lookup(b).front(), minSrf);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(SurfaceArray_singleElement) {
   double w = 3, h = 4;
   auto bounds = std::make_shared<const RectangleBounds>(w, h);
@@ -130,6 +130,37 @@ BOOST_AUTO_TEST_CASE(SurfaceProperties) {
   // type() is pure virtual
 }
 
+BOOST_AUTO_TEST_CASE(SurfaceInverseTransform) {
+  Transform3 transform = Transform3::Identity();
+  transform.pretranslate(Vector3{1., -2., 3.});
+  transform.rotate(AngleAxis3(0.3, Vector3(1., 2., 3.).normalized()));
+  std::shared_ptr<const Acts::PlanarBounds> pPlanarBound =
+      std::make_shared<const RectangleBounds>(5., 10.);
+  Vector3 position{4., 5., 6.};
+
+  // surface owning its transform
+  auto plane = Surface::makeShared<PlaneSurface>(transform, pPlanarBound);
+  CHECK_CLOSE_OR_SMALL(plane->inverseTransform(tgContext).matrix(),
+                       transform.inverse().matrix(), 1e-12, 1e-12);
+  CHECK_CLOSE_OR_SMALL(plane->inverseTransform(tgContext) * position,
+                       transform.inverse() * position, 1e-12, 1e-12);
+
+  // the cache follows copies and shifts
+  auto copy = Surface::makeShared<PlaneSurface>(*plane);
+  CHECK_CLOSE_OR_SMALL(copy->inverseTransform(tgContext).matrix(),
+                       transform.inverse().matrix(), 1e-12, 1e-12);
+  Transform3 shift(Translation3(0., 0., 10.));
+  auto shifted = Surface::makeShared<PlaneSurface>(tgContext, *plane, shift);
+  CHECK_CLOSE_OR_SMALL(shifted->inverseTransform(tgContext).matrix(),
+                       (shift * transform).inverse().matrix(), 1e-12, 1e-12);
+
+  // surface forwarding to a detector element
+  DetectorElementStub detElement{transform, pPlanarBound, 0.2, nullptr};
+  SurfaceStub surface(detElement);
+  CHECK_CLOSE_OR_SMALL(surface.inverseTransform(tgContext).matrix(),
+                       transform.inverse().matrix(), 1e-12, 1e-12);
+}
+
 BOOST_AUTO_TEST_CASE(EqualityOperators) {
   // build some test objects
   std::shared_ptr<const Acts::PlanarBounds> pPlanarBound =
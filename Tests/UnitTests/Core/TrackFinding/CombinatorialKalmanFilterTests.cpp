@@ -34,10 +34,12 @@
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/LineSurfaceStub.hpp"
 #include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
 #include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/TrackFinalization.hpp"
 #include "Acts/TrackFitting/GainMatrixSmoother.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
 #include "Acts/TrackFitting/KalmanFitter.hpp"
@@ -416,4 +418,158 @@ BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(DeferredFinalization) {
+  Fixture f(0_T);
+
+  auto options = f.makeCkfOptions();
+  auto pSurface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3{-3_m, 0., 0.}, Acts::Vector3{1., 0., 0});
+  options.smoothingTargetSurface = pSurface.get();
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+  options.sourcelinkAccessor.connect<&Fixture::TestSourceLinkAccessor::range>(
+      &slAccessor);
+
+  // reference with smoothing and extrapolation in the CKF
+  Acts::TrackContainer tcRef{Acts::VectorTrackContainer{},
+                             Acts::VectorMultiTrajectory{}};
+  // filtering only, finalized afterwards
+  Acts::TrackContainer tc{Acts::VectorTrackContainer{},
+                          Acts::VectorMultiTrajectory{}};
+
+  for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+       ++trackId) {
+    options.smoothing = true;
+    BOOST_REQUIRE(
+        f.ckf.findTracks(f.startParameters.at(trackId), options, tcRef).ok());
+    options.smoothing = false;
+    BOOST_REQUIRE(
+        f.ckf.findTracks(f.startParameters.at(trackId), options, tc).ok());
+  }
+  BOOST_CHECK_EQUAL(tcRef.size(), 3u);
+  BOOST_CHECK_EQUAL(tc.size(), 3u);
+
+  auto propagator =
+      Fixture::makeConstantFieldPropagator(f.detector.geometry, 0_T);
+  Acts::PropagatorOptions<> propOptions(f.geoCtx, f.magCtx);
+
+  for (std::size_t trackId = 0u; trackId < tc.size(); ++trackId) {
+    auto track = tc.getTrack(trackId);
+    BOOST_CHECK(!track.hasReferenceSurface());
+
+    BOOST_REQUIRE(Acts::smoothTrack(f.geoCtx, track, *f.logger).ok());
+    BOOST_REQUIRE(Acts::extrapolateTrackToReferenceSurface(
+                      track, *pSurface, propagator, propOptions,
+                      Acts::TrackExtrapolationStrategy::firstOrLast, *f.logger)
+                      .ok());
+
+    const auto refTrack = tcRef.getTrack(trackId);
+    BOOST_CHECK_EQUAL(&track.referenceSurface(), pSurface.get());
+    BOOST_CHECK_EQUAL(track.nMeasurements(), refTrack.nMeasurements());
+    CHECK_CLOSE_ABS(track.parameters(), refTrack.parameters(), 1e-6);
+    CHECK_CLOSE_ABS(track.covariance(), refTrack.covariance(), 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PackedTrackStateCovariances) {
+  Fixture f(0_T);
+
+  auto options = f.makeCkfOptions();
+  auto pSurface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3{-3_m, 0., 0.}, Acts::Vector3{1., 0., 0});
+  options.smoothingTargetSurface = pSurface.get();
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+  options.sourcelinkAccessor.connect<&Fixture::TestSourceLinkAccessor::range>(
+      &slAccessor);
+
+  Acts::TrackContainer tc{Acts::VectorTrackContainer{},
+                          Acts::VectorMultiTrajectory{}};
+  for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+       ++trackId) {
+    BOOST_REQUIRE(
+        f.ckf.findTracks(f.startParameters.at(trackId), options, tc).ok());
+  }
+  BOOST_CHECK_EQUAL(tc.size(), 3u);
+
+  // pack a copy into read-only containers, as done when the found tracks are
+  // handed on
+  Acts::VectorTrackContainer trackContainer = tc.container();
+  Acts::VectorMultiTrajectory trackStateContainer = tc.trackStateContainer();
+  Acts::TrackContainer packed{
+      Acts::ConstVectorTrackContainer{std::move(trackContainer)},
+      Acts::ConstVectorMultiTrajectory{
+          std::move(trackStateContainer),
+          Acts::ConstVectorMultiTrajectory::CovarianceStorage::Packed}};
+  BOOST_REQUIRE_EQUAL(packed.size(), tc.size());
+
+  for (std::size_t trackId = 0u; trackId < tc.size(); ++trackId) {
+    const auto refTrack = tc.getTrack(trackId);
+    const auto track = packed.getTrack(trackId);
+    BOOST_CHECK_EQUAL(track.nTrackStates(), refTrack.nTrackStates());
+    BOOST_CHECK_EQUAL(track.nMeasurements(), refTrack.nMeasurements());
+    BOOST_CHECK_EQUAL(track.chi2(), refTrack.chi2());
+    BOOST_CHECK_EQUAL(track.parameters(), refTrack.parameters());
+    BOOST_CHECK_EQUAL(track.covariance(), refTrack.covariance());
+
+    auto refStates = refTrack.trackStatesReversed();
+    auto refState = refStates.begin();
+    for (const auto state : track.trackStatesReversed()) {
+      BOOST_REQUIRE(refState != refStates.end());
+      const auto ref = *refState;
+      BOOST_CHECK_EQUAL(state.getMask(), ref.getMask());
+      BOOST_CHECK_EQUAL(state.typeFlags().test(Acts::MeasurementFlag),
+                        ref.typeFlags().test(Acts::MeasurementFlag));
+      BOOST_CHECK_EQUAL(state.typeFlags().test(Acts::OutlierFlag),
+                        ref.typeFlags().test(Acts::OutlierFlag));
+      BOOST_CHECK_EQUAL(state.typeFlags().test(Acts::HoleFlag),
+                        ref.typeFlags().test(Acts::HoleFlag));
+      BOOST_CHECK_EQUAL(state.pathLength(), ref.pathLength());
+      BOOST_CHECK_EQUAL(state.chi2(), ref.chi2());
+      BOOST_CHECK_EQUAL(&state.referenceSurface(), &ref.referenceSurface());
+      // the packed covariances are symmetrized
+      BOOST_REQUIRE_EQUAL(state.hasPredicted(), ref.hasPredicted());
+      if (ref.hasPredicted()) {
+        BOOST_CHECK_EQUAL(state.predicted(), ref.predicted());
+        CHECK_CLOSE_ABS(state.predictedCovariance(), ref.predictedCovariance(),
+                        1e-9);
+      }
+      BOOST_REQUIRE_EQUAL(state.hasFiltered(), ref.hasFiltered());
+      if (ref.hasFiltered()) {
+        BOOST_CHECK_EQUAL(state.filtered(), ref.filtered());
+        CHECK_CLOSE_ABS(state.filteredCovariance(), ref.filteredCovariance(),
+                        1e-9);
+      }
+      BOOST_REQUIRE_EQUAL(state.hasSmoothed(), ref.hasSmoothed());
+      if (ref.hasSmoothed()) {
+        BOOST_CHECK_EQUAL(state.smoothed(), ref.smoothed());
+        CHECK_CLOSE_ABS(state.smoothedCovariance(), ref.smoothedCovariance(),
+                        1e-9);
+      }
+      BOOST_REQUIRE_EQUAL(state.hasJacobian(), ref.hasJacobian());
+      if (ref.hasJacobian()) {
+        BOOST_CHECK_EQUAL(state.jacobian(), ref.jacobian());
+      }
+      BOOST_REQUIRE_EQUAL(state.hasCalibrated(), ref.hasCalibrated());
+      if (ref.hasCalibrated()) {
+        BOOST_CHECK_EQUAL(state.calibratedSize(), ref.calibratedSize());
+        BOOST_CHECK_EQUAL(state.effectiveCalibrated(),
+                          ref.effectiveCalibrated());
+        BOOST_CHECK_EQUAL(state.effectiveCalibratedCovariance(),
+                          ref.effectiveCalibratedCovariance());
+        BOOST_CHECK_EQUAL(state.getUncalibratedSourceLink()
+                              .template get<TestSourceLink>()
+                              .sourceId,
+                          ref.getUncalibratedSourceLink()
+                              .template get<TestSourceLink>()
+                              .sourceId);
+      }
+      ++refState;
+    }
+    BOOST_CHECK(refState == refStates.end());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/TrackFinding/RoiDescriptor.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+
+#include <cmath>
+
+using namespace Acts;
+
+BOOST_AUTO_TEST_SUITE(TrackFindingRoiDescriptor)
+
+BOOST_AUTO_TEST_CASE(ContainsPosition) {
+  // RoI around eta = 1 and phi = 0, starting from |z| < 100 at the beamline
+  RoiDescriptor roi(1, 0.9, 1.1, 0, -0.1, 0.1, 0, -100, 100);
+
+  BOOST_CHECK(!roi.isFullscan());
+  BOOST_CHECK_CLOSE(roi.zedMin(0), -100, 1e-4);
+  BOOST_CHECK_CLOSE(roi.zedMax(0), 100, 1e-4);
+
+  const double r = 500;
+  const double z = r * std::sinh(1.);
+  BOOST_CHECK(roi.contains(z, r, 0.05));
+  BOOST_CHECK(!roi.contains(z, r, 0.2));
+  BOOST_CHECK(!roi.contains(-z, r, 0.05));
+  // the front and rear boundaries pass through the beamline extent
+  BOOST_CHECK(roi.containsZed(r * std::sinh(1.1) + 99, r));
+  BOOST_CHECK(!roi.containsZed(r * std::sinh(1.1) + 101, r));
+  BOOST_CHECK(roi.containsZed(r * std::sinh(0.9) - 99, r));
+  BOOST_CHECK(!roi.containsZed(r * std::sinh(0.9) - 101, r));
+
+  // radial range at the given z is consistent with the z range
+  BOOST_CHECK_LE(roi.rhoMin(z), r);
+  BOOST_CHECK_GE(roi.rhoMax(z), r);
+  BOOST_CHECK(roi.containsZed(z, roi.rhoMin(z) + 1e-3));
+  BOOST_CHECK(roi.containsZed(z, roi.rhoMax(z) - 1e-3));
+}
+
+BOOST_AUTO_TEST_CASE(PhiWrapAround) {
+  RoiDescriptor roi(0, -0.1, 0.1, M_PI, M_PI - 0.1, -M_PI + 0.1);
+
+  BOOST_CHECK(roi.containsPhi(M_PI - 0.05));
+  BOOST_CHECK(roi.containsPhi(-M_PI + 0.05));
+  BOOST_CHECK(!roi.containsPhi(0));
+}
+
+BOOST_AUTO_TEST_CASE(FullscanAndComposite) {
+  RoiDescriptor fullscan(RoiDescriptor::FULLSCAN);
+  BOOST_CHECK(fullscan.isFullscan());
+  BOOST_CHECK(fullscan.contains(1e4, 1, 3));
+
+  RoiDescriptor first(0, -0.1, 0.1, 1, 0.9, 1.1);
+  RoiDescriptor second(0, -0.1, 0.1, -1, -1.1, -0.9);
+  RoiDescriptor composite(RoiDescriptor::ROI);
+  composite.push_back(&first);
+  composite.push_back(&second);
+
+  BOOST_CHECK(composite.composite());
+  BOOST_CHECK(composite.contains(0, 100, 1));
+  BOOST_CHECK(composite.contains(0, 100, -1));
+  BOOST_CHECK(!composite.contains(0, 100, 0));
+}
+
+BOOST_AUTO_TEST_CASE(OverlapsExtent) {
+  RoiDescriptor roi(0, -0.1, 0.1, 0, -0.1, 0.1, 0, -50, 50);
+
+  Extent inside;
+  inside.set(binR, 100, 120);
+  inside.set(binZ, -20, 20);
+  inside.set(binPhi, -0.05, 0.05);
+  BOOST_CHECK(roi.overlaps(inside));
+
+  Extent otherPhi = inside;
+  otherPhi.set(binPhi, 1, 1.2);
+  BOOST_CHECK(!roi.overlaps(otherPhi));
+
+  Extent otherZ = inside;
+  otherZ.set(binZ, 200, 300);
+  BOOST_CHECK(!roi.overlaps(otherZ));
+
+  // partial overlap at the RoI boundary is accepted
+  Extent boundary = inside;
+  boundary.set(binZ, 40, 300);
+  BOOST_CHECK(roi.overlaps(boundary));
+
+  // unconstrained extents cannot be excluded
+  BOOST_CHECK(roi.overlaps(Extent()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
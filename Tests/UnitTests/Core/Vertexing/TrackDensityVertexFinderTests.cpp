@@ -200,6 +200,79 @@ BOOST_AUTO_TEST_CASE(track_density_finder_constr_test) {
   }
 }
 
+///
+/// @brief Unit test for TrackDensityVertexFinder returning multiple seeds from
+/// a single evaluation of the track density
+///
+BOOST_AUTO_TEST_CASE(track_density_finder_multiple_seeds_test) {
+  Covariance covMat = Covariance::Identity();
+
+  Vector3 pos0{0, 0, 0};
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(pos0);
+
+  // Four well separated clusters with decreasing number of tracks
+  std::vector<double> clusterZs = {-40_mm, -10_mm, 20_mm, 50_mm};
+  std::vector<BoundTrackParameters> trackVec;
+  for (std::size_t iCluster = 0; iCluster < clusterZs.size(); ++iCluster) {
+    const std::size_t nTracks = 6 - iCluster;
+    for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+      const double z0 = clusterZs[iCluster] + (iTrack * 0.1_mm) -
+                        0.05_mm * static_cast<double>(nTracks - 1);
+      BoundVector paramVec;
+      paramVec << 0.01_mm, z0, 0.5, M_PI_2, 1. / 1_GeV, 0.;
+      trackVec.emplace_back(perigeeSurface, paramVec, covMat,
+                            ParticleHypothesis::pion());
+    }
+  }
+  std::vector<const BoundTrackParameters*> trackPtrVec;
+  for (const auto& trk : trackVec) {
+    trackPtrVec.push_back(&trk);
+  }
+
+  VertexingOptions<BoundTrackParameters> vertexingOptions(geoContext,
+                                                          magFieldContext);
+  using Finder =
+      TrackDensityVertexFinder<DummyVertexFitter<>,
+                               GaussianTrackDensity<BoundTrackParameters>>;
+  Finder::State state;
+
+  Finder singleFinder;
+  auto singleRes = singleFinder.find(trackPtrVec, vertexingOptions, state);
+  BOOST_REQUIRE(singleRes.ok());
+  BOOST_REQUIRE_EQUAL((*singleRes).size(), 1u);
+
+  // All maxima are found, ordered by increasing density
+  Finder::Config cfg;
+  cfg.maxNumberOfSeeds = 10;
+  Finder multiFinder(cfg);
+  auto multiRes = multiFinder.find(trackPtrVec, vertexingOptions, state);
+  BOOST_REQUIRE(multiRes.ok());
+  BOOST_REQUIRE_EQUAL((*multiRes).size(), clusterZs.size());
+  for (std::size_t i = 0; i < clusterZs.size(); ++i) {
+    CHECK_CLOSE_ABS((*multiRes)[i].position()[eZ],
+                    clusterZs[clusterZs.size() - 1 - i], 0.01_mm);
+  }
+
+  // The most prominent seed comes last and agrees with the single seed
+  BOOST_CHECK_EQUAL((*multiRes).back().position()[eZ],
+                    (*singleRes).back().position()[eZ]);
+
+  // Limiting the number of seeds keeps the most prominent ones
+  for (std::size_t nSeeds : {2u, 3u}) {
+    cfg.maxNumberOfSeeds = nSeeds;
+    Finder limitedFinder(cfg);
+    auto limitedRes = limitedFinder.find(trackPtrVec, vertexingOptions, state);
+    BOOST_REQUIRE(limitedRes.ok());
+    BOOST_REQUIRE_EQUAL((*limitedRes).size(), nSeeds);
+    for (std::size_t i = 0; i < nSeeds; ++i) {
+      BOOST_CHECK_EQUAL(
+          (*limitedRes)[i].position()[eZ],
+          (*multiRes)[clusterZs.size() - nSeeds + i].position()[eZ]);
+    }
+  }
+}
+
 const double zVertexPos = 12.;
 // x position
 std::normal_distribution<double> xdist(1_mm, 0.1_mm);
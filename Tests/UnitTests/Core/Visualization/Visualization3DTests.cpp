@@ -10,11 +10,23 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Visualization/GeometryView3D.hpp"
 #include "Acts/Visualization/IVisualization3D.hpp"
 #include "Acts/Visualization/ObjVisualization3D.hpp"
 #include "Acts/Visualization/PlyVisualization3D.hpp"
 
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -319,6 +331,127 @@ f 1 2 3
   BOOST_CHECK(output.is_equal(exp));
 }
 
+BOOST_AUTO_TEST_CASE(ObjFlushTest) {
+  ObjVisualization3D obj;
+
+  output_test_stream output;
+  output_test_stream materials;
+
+  obj.face({{1, 0, 0}, {1, 1, 0}, {0, 1, 0}}, {10, 20, 30});
+  obj.flush(output, materials);
+
+  obj.line({0, 0, 1}, {1, 0, 0}, {10, 20, 30});
+  obj.face({{1, 0, 0}, {1, 1, 0}, {0, 1, 0}});
+  obj.flush(output, materials);
+
+  // Vertex numbering continues after the flush
+  std::string exp = R"(usemtl material_10_20_30
+v 1 0 0
+v 1 1 0
+v 0 1 0
+usemtl material_10_20_30
+f 1 2 3
+usemtl material_10_20_30
+v 0 0 1
+v 1 0 0
+usemtl material_0_0_0
+v 1 0 0
+v 1 1 0
+v 0 1 0
+usemtl material_10_20_30
+l 4 5
+f 6 7 8
+)";
+  BOOST_CHECK(output.is_equal(exp));
+  BOOST_CHECK(testObjString(exp).empty());
+
+  // Each material is only defined once
+  std::string expMaterials = R"(newmtl material_10_20_30
+Ka 0.039062 0.078125 0.117188 
+Kd 0.039062 0.078125 0.117188 
+Ks 0.039062 0.078125 0.117188 
+
+newmtl material_0_0_0
+Ka 0.000000 0.000000 0.000000 
+Kd 0.000000 0.000000 0.000000 
+Ks 0.000000 0.000000 0.000000 
+
+)";
+  BOOST_CHECK(materials.is_equal(expMaterials));
+
+  // Nothing buffered anymore
+  obj.write(output);
+  BOOST_CHECK(output.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(ObjChunkedSurfaceArrayTest) {
+  GeometryContext gctx;
+  // more surfaces than written per chunk, with a few distinct bounds
+  std::vector<std::shared_ptr<RectangleBounds>> bounds = {
+      std::make_shared<RectangleBounds>(10., 20.),
+      std::make_shared<RectangleBounds>(15., 5.)};
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  for (std::size_t i = 0; i < 2500; ++i) {
+    Transform3 transform(Translation3(i % 50, i / 50, i % 7));
+    surfaces.push_back(Surface::makeShared<PlaneSurface>(
+        transform, bounds[i % bounds.size()]));
+  }
+  SurfaceArray surfaceArray(
+      std::make_unique<SurfaceArray::SingleElementLookup>(
+          unpack_shared_vector(surfaces)),
+      surfaces);
+
+  // reference with all surfaces drawn directly into a single buffer
+  ObjVisualization3D reference;
+  for (const auto& surface : surfaces) {
+    GeometryView3D::drawSurface(reference, *surface, gctx,
+                                Transform3::Identity(), s_viewPassive);
+  }
+  std::stringstream expected;
+  reference.write(expected);
+
+  auto outputDir = std::filesystem::temp_directory_path() / "ActsObjChunked";
+  std::filesystem::create_directories(outputDir);
+  ViewConfig sensitiveConfig = s_viewSensitive;
+  sensitiveConfig.outputName = "surfaces";
+  ObjVisualization3D obj;
+  GeometryView3D::TessellationCache cache;
+  GeometryView3D::drawSurfaceArray(obj, surfaceArray, gctx,
+                                   Transform3::Identity(), sensitiveConfig,
+                                   s_viewPassive, s_viewGrid,
+                                   outputDir.string(), &cache);
+  std::ifstream file(outputDir / "surfaces.obj");
+  BOOST_REQUIRE(file.good());
+  BOOST_CHECK(std::filesystem::exists(outputDir / "surfaces.mtl"));
+
+  // every chunk writes its vertices before its faces, the faces refer to
+  // the vertices of all chunks
+  auto geometryLines = [](std::istream& is, const std::string& prefix) {
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(is, line)) {
+      if (line.rfind(prefix, 0) == 0) {
+        lines.push_back(line);
+      }
+    }
+    is.clear();
+    is.seekg(0);
+    return lines;
+  };
+  std::vector<std::string> vertices = geometryLines(file, "v ");
+  std::vector<std::string> faces = geometryLines(file, "f ");
+  BOOST_CHECK_EQUAL(vertices.size(), 2500u * 4u);
+  BOOST_CHECK_EQUAL(faces.size(), 2500u);
+  BOOST_CHECK(vertices == geometryLines(expected, "v "));
+  BOOST_CHECK(faces == geometryLines(expected, "f "));
+
+  // nothing is left buffered
+  output_test_stream output;
+  obj.write(output);
+  BOOST_CHECK(output.is_empty());
+  std::filesystem::remove_all(outputDir);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Test
 }  // namespace Acts
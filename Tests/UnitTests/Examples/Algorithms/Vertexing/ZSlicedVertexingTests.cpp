@@ -0,0 +1,247 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Vertexing/TrackAtVertex.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+#include "ActsExamples/Vertexing/ZSlicedVertexing.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+using Tracks = std::vector<const BoundTrackParameters*>;
+using Vertices = std::vector<Vertex<BoundTrackParameters>>;
+
+const auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+std::vector<BoundTrackParameters> makeTracks(const std::vector<double>& z0s) {
+  std::vector<BoundTrackParameters> tracks;
+  for (double z0 : z0s) {
+    BoundVector params = BoundVector::Zero();
+    params[eBoundLoc1] = z0;
+    params[eBoundTheta] = M_PI_2;
+    params[eBoundQOverP] = 1.;
+    // sigma(z0) = 0.1
+    BoundSquareMatrix cov = BoundSquareMatrix::Identity() * 0.01;
+    tracks.emplace_back(perigee, params, cov, ParticleHypothesis::pion());
+  }
+  return tracks;
+}
+
+Tracks pointers(const std::vector<BoundTrackParameters>& tracks) {
+  Tracks ptrs;
+  for (const auto& trk : tracks) {
+    ptrs.push_back(&trk);
+  }
+  return ptrs;
+}
+
+double z0(const BoundTrackParameters* trk) {
+  return trk->parameters()[eBoundLoc1];
+}
+
+/// Three clusters at -20, 0 and 20 and a single track at -7. The first
+/// boundary lies between the track at -7 and the cluster at 0, both are in
+/// the overlap of the first two slices.
+const std::vector<double> kZ0s = {-20.2, -20, -19.8, -7,  -0.1,
+                                  0,     0.1, 19.8,  20., 20.2};
+
+ZSlicingConfig makeConfig() {
+  ZSlicingConfig cfg;
+  cfg.sliceWidth = 15;
+  cfg.overlap = 5;
+  cfg.nSigmaZ0 = 3;
+  return cfg;
+}
+
+/// Mock finder with a vertex per group of tracks closer than 1 apart. If
+/// requested, every track of the slice is attached to every vertex with a
+/// weight falling with the distance.
+Result<Vertices> findGroups(const Tracks& tracks, bool attachAll) {
+  Tracks sorted = tracks;
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto* a, const auto* b) { return z0(a) < z0(b); });
+  Vertices vertices;
+  std::vector<Tracks> groups;
+  for (const auto* trk : sorted) {
+    if (groups.empty() || z0(trk) - z0(groups.back().back()) > 1.) {
+      groups.emplace_back();
+    }
+    groups.back().push_back(trk);
+  }
+  for (const auto& group : groups) {
+    double z = 0;
+    for (const auto* trk : group) {
+      z += z0(trk) / group.size();
+    }
+    Vertex<BoundTrackParameters> vtx(Vector3(0, 0, z));
+    std::vector<TrackAtVertex<BoundTrackParameters>> tracksAtVertex;
+    for (const auto* trk : (attachAll ? sorted : group)) {
+      tracksAtVertex.emplace_back(*trk, trk);
+      tracksAtVertex.back().trackWeight = std::exp(-std::abs(z0(trk) - z));
+    }
+    vtx.setTracksAtVertex(std::move(tracksAtVertex));
+    vertices.push_back(std::move(vtx));
+  }
+  return vertices;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ZSlicedVertexingTests)
+
+BOOST_AUTO_TEST_CASE(SliceBoundaries) {
+  auto tracks = makeTracks(kZ0s);
+  Tracks ptrs = pointers(tracks);
+  std::vector<ZSlice> slices = makeZSlices(ptrs, makeConfig());
+
+  // boundaries half-way between the tracks around the gaps
+  BOOST_REQUIRE_EQUAL(slices.size(), 3u);
+  BOOST_CHECK_EQUAL(slices[0].zMin, -std::numeric_limits<double>::infinity());
+  BOOST_CHECK_CLOSE(slices[0].zMax, 0.5 * (-7 - 0.1), 1e-9);
+  BOOST_CHECK_CLOSE(slices[1].zMax, 0.5 * (0.1 + 19.8), 1e-9);
+  BOOST_CHECK_EQUAL(slices[2].zMax, std::numeric_limits<double>::infinity());
+  for (std::size_t i = 1; i < slices.size(); ++i) {
+    BOOST_CHECK_EQUAL(slices[i].zMin, slices[i - 1].zMax);
+  }
+
+  // every track is in the slice containing it, and in the neighbouring
+  // slices only if within the overlap
+  const double reach = 5 + 3 * 0.1;
+  for (const auto* trk : ptrs) {
+    for (const auto& slice : slices) {
+      const bool inside = slice.zMin <= z0(trk) && z0(trk) < slice.zMax;
+      const bool inOverlap =
+          slice.zMin - reach < z0(trk) && z0(trk) < slice.zMax + reach;
+      const bool assigned = std::find(slice.tracks.begin(), slice.tracks.end(),
+                                      trk) != slice.tracks.end();
+      BOOST_CHECK(!inside || assigned);
+      BOOST_CHECK_EQUAL(assigned, inOverlap);
+    }
+  }
+  // the track at -7 and the cluster at 0 are in the overlap of the first two
+  // slices
+  BOOST_CHECK_EQUAL(slices[0].tracks.size(), 7u);
+  BOOST_CHECK_EQUAL(slices[1].tracks.size(), 4u);
+  BOOST_CHECK_EQUAL(slices[2].tracks.size(), 3u);
+
+  // no slicing
+  ZSlicingConfig noSlicing;
+  slices = makeZSlices(ptrs, noSlicing);
+  BOOST_REQUIRE_EQUAL(slices.size(), 1u);
+  BOOST_CHECK(slices[0].tracks == ptrs);
+  slices = makeZSlices({}, makeConfig());
+  BOOST_REQUIRE_EQUAL(slices.size(), 1u);
+  BOOST_CHECK(slices[0].tracks.empty());
+}
+
+BOOST_AUTO_TEST_CASE(DuplicatesAtSeams) {
+  auto tracks = makeTracks(kZ0s);
+  Tracks ptrs = pointers(tracks);
+
+  // the vertex at -7 is found in the first two slices but kept once
+  Vertices vertices = findVerticesInZSlices(
+      ptrs, makeConfig(),
+      [](const Tracks& sliceTracks) { return findGroups(sliceTracks, false); },
+      getDummyLogger());
+
+  Vertices reference = *findGroups(ptrs, false);
+  BOOST_REQUIRE_EQUAL(vertices.size(), reference.size());
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    BOOST_CHECK_CLOSE(vertices[i].position()[eZ], reference[i].position()[eZ],
+                      1e-9);
+    BOOST_CHECK_EQUAL(vertices[i].tracks().size(),
+                      reference[i].tracks().size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DoubleSliceAssignment) {
+  auto tracks = makeTracks(kZ0s);
+  Tracks ptrs = pointers(tracks);
+  ZSlicingConfig cfg = makeConfig();
+  std::vector<ZSlice> slices = makeZSlices(ptrs, cfg);
+
+  Vertices vertices = findVerticesInZSlices(
+      ptrs, cfg,
+      [](const Tracks& sliceTracks) { return findGroups(sliceTracks, true); },
+      getDummyLogger());
+  BOOST_REQUIRE_EQUAL(vertices.size(), 4u);
+
+  // every track is attached to the vertices of a single slice only
+  auto sliceOf = [&](const Vertex<BoundTrackParameters>& vtx) {
+    for (std::size_t i = 0; i < slices.size(); ++i) {
+      if (slices[i].zMin <= vtx.position()[eZ] &&
+          vtx.position()[eZ] < slices[i].zMax) {
+        return i;
+      }
+    }
+    return slices.size();
+  };
+  std::map<const BoundTrackParameters*, std::set<std::size_t>> trackSlices;
+  for (const auto& vtx : vertices) {
+    for (const auto& trk : vtx.tracks()) {
+      trackSlices[trk.originalParams].insert(sliceOf(vtx));
+    }
+  }
+  BOOST_CHECK_EQUAL(trackSlices.size(), ptrs.size());
+  for (const auto& [trk, sliceIndices] : trackSlices) {
+    BOOST_CHECK_EQUAL(sliceIndices.size(), 1u);
+  }
+  // the overlap tracks stay with the slice of their own vertex
+  BOOST_CHECK_EQUAL(*trackSlices.at(ptrs[3]).begin(), 0u);
+  BOOST_CHECK_EQUAL(*trackSlices.at(ptrs[5]).begin(), 1u);
+  // tracks shared between vertices of one slice are kept
+  BOOST_CHECK_EQUAL(vertices[0].tracks().size(), 4u);
+  BOOST_CHECK_EQUAL(vertices[1].tracks().size(), 4u);
+  BOOST_CHECK_EQUAL(vertices[2].tracks().size(), 3u);
+  BOOST_CHECK_EQUAL(vertices[3].tracks().size(), 3u);
+
+  // largest weight wins, the first slice on ties
+  auto makeVertex = [&](std::vector<std::pair<std::size_t, double>> trks) {
+    Vertex<BoundTrackParameters> vtx(Vector3(0, 0, 0));
+    std::vector<TrackAtVertex<BoundTrackParameters>> tracksAtVertex;
+    for (auto [i, weight] : trks) {
+      tracksAtVertex.emplace_back(*ptrs[i], ptrs[i]);
+      tracksAtVertex.back().trackWeight = weight;
+    }
+    vtx.setTracksAtVertex(std::move(tracksAtVertex));
+    return vtx;
+  };
+  Vertices manual = {makeVertex({{0, 1.}, {1, 0.3}, {2, 0.5}}),
+                     makeVertex({{1, 0.8}, {2, 0.5}}), makeVertex({{1, 0.5}})};
+  removeDoubleSliceAssignments(manual, {0, 1, 1});
+  BOOST_REQUIRE_EQUAL(manual[0].tracks().size(), 2u);
+  BOOST_CHECK_EQUAL(manual[0].tracks()[0].originalParams, ptrs[0]);
+  BOOST_CHECK_EQUAL(manual[0].tracks()[1].originalParams, ptrs[2]);
+  BOOST_REQUIRE_EQUAL(manual[1].tracks().size(), 1u);
+  BOOST_CHECK_EQUAL(manual[1].tracks()[0].originalParams, ptrs[1]);
+  BOOST_REQUIRE_EQUAL(manual[2].tracks().size(), 1u);
+  BOOST_CHECK_EQUAL(manual[2].tracks()[0].originalParams, ptrs[1]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
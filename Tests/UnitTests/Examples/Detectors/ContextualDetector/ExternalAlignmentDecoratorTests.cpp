@@ -0,0 +1,101 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/ContextualDetector/AlignedDetector.hpp"
+#include "ActsExamples/ContextualDetector/ExternalAlignmentDecorator.hpp"
+#include "ActsExamples/ContextualDetector/ExternallyAlignedDetectorElement.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <cstddef>
+#include <memory>
+
+using namespace Acts::UnitLiterals;
+using namespace ActsExamples;
+using namespace ActsExamples::Contextual;
+
+namespace {
+
+using AlignmentStore = ExternallyAlignedDetectorElement::AlignmentStore;
+
+std::shared_ptr<const AlignmentStore> decorate(
+    ExternalAlignmentDecorator& decorator, std::size_t event) {
+  WhiteBoard eventStore;
+  AlgorithmContext context(0, event, eventStore);
+  BOOST_REQUIRE(decorator.decorate(context) == ProcessCode::SUCCESS);
+  return context.geoContext.get<ExternallyAlignedDetectorElement::ContextType>()
+      .alignmentStore;
+}
+
+void checkEqual(const AlignmentStore& a, const AlignmentStore& b) {
+  BOOST_REQUIRE_EQUAL(a.transforms.size(), b.transforms.size());
+  BOOST_REQUIRE_EQUAL(a.inverseTransforms.size(), b.inverseTransforms.size());
+  for (std::size_t i = 0; i < a.transforms.size(); ++i) {
+    BOOST_CHECK(a.transforms[i].matrix() == b.transforms[i].matrix());
+    BOOST_CHECK(a.inverseTransforms[i].matrix() ==
+                b.inverseTransforms[i].matrix());
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExternalAlignmentDecoratorTests)
+
+BOOST_AUTO_TEST_CASE(SameIovSameTransforms) {
+  AlignedDetector detector;
+  AlignedDetector::Config detectorConfig;
+  detectorConfig.mode = AlignedDetector::Config::Mode::External;
+  auto [trackingGeometry, decorators] =
+      detector.finalize(detectorConfig, nullptr);
+
+  ExternalAlignmentDecorator::Config cfg;
+  cfg.trackingGeometry = trackingGeometry;
+  cfg.iovSize = 10;
+  cfg.flushSize = 5;
+  cfg.gSigmaX = 100_um;
+  cfg.gSigmaY = 100_um;
+  cfg.aSigmaZ = 0.02;
+  cfg.randomNumberSvc =
+      std::make_shared<RandomNumbers>(RandomNumbers::Config{42});
+
+  ExternalAlignmentDecorator decorator(
+      cfg, Acts::getDefaultLogger("Decorator", Acts::Logging::INFO));
+  cfg.nPrefetchIovs = 2;
+  ExternalAlignmentDecorator prefetching(
+      cfg, Acts::getDefaultLogger("Prefetching", Acts::Logging::INFO));
+
+  auto store = decorate(decorator, 3);
+  BOOST_REQUIRE(store != nullptr);
+  BOOST_CHECK(!store->transforms.empty());
+
+  // events of the same iov share the store
+  BOOST_CHECK_EQUAL(decorate(decorator, 7), store);
+  BOOST_CHECK_NE(decorate(decorator, 13), store);
+
+  // independent of the event requesting the iov first and of the prefetching
+  checkEqual(*decorate(prefetching, 9), *store);
+  checkEqual(*decorate(prefetching, 13), *decorate(decorator, 13));
+  checkEqual(*decorate(prefetching, 25), *decorate(decorator, 21));
+
+  // prepared again after the garbage collection
+  auto transforms = *store;
+  store.reset();
+  for (std::size_t event = 30; event < 100; ++event) {
+    decorate(decorator, event);
+  }
+  checkEqual(*decorate(decorator, 0), transforms);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,274 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Io/Root/RootTrackSummaryWriter.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TTreeReader.h>
+#include <TTreeReaderValue.h>
+
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6, 31, 0)
+#include <ROOT/RNTupleReader.hxx>
+#else
+#include <ROOT/RNTuple.hxx>
+#endif
+#endif
+
+using namespace ActsExamples;
+using namespace Acts::Test;
+
+namespace {
+
+/// Tracks with fitted parameters at a perigee surface and covariances,
+/// every third track has no reference surface
+ConstTrackContainer makeTestTracks(std::size_t nTracks) {
+  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
+  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  TrackContainer tracks(trackContainer, trackStateContainer);
+
+  auto perigee =
+      Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3::Zero());
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    auto track = tracks.getTrack(tracks.addTrack());
+    track.nMeasurements() = 10 + i;
+    track.nHoles() = i % 2;
+    track.chi2() = 1.5 * i;
+    track.nDoF() = 2 * (10 + i);
+    if (i % 3 == 2) {
+      continue;
+    }
+    track.setReferenceSurface(perigee);
+    Acts::BoundVector params;
+    params << 0.1 * i, -0.2 * i, 0.3, 1.2, 1. / (1. + i), 0.;
+    track.parameters() = params;
+    track.covariance() =
+        Acts::BoundSquareMatrix::Identity() * 0.01 * (1. + i);
+    track.covariance()(Acts::eBoundLoc0, Acts::eBoundLoc1) = 0.001 * i;
+    track.covariance()(Acts::eBoundLoc1, Acts::eBoundLoc0) = 0.001 * i;
+  }
+
+  return ConstTrackContainer{std::make_shared<Acts::ConstVectorTrackContainer>(
+                                 std::move(*trackContainer)),
+                             std::make_shared<Acts::ConstVectorMultiTrajectory>(
+                                 std::move(*trackStateContainer))};
+}
+
+/// Write the same events with the given output format, optionally in the
+/// output shard of a worker process
+void writeTracks(const std::string& path, bool writeRNTuple,
+                 const std::vector<ConstTrackContainer>& events,
+                 std::optional<std::size_t> worker = std::nullopt) {
+  RootTrackSummaryWriter::Config writerConfig;
+  writerConfig.inputTracks = "tracks";
+  writerConfig.inputParticles = "particles";
+  writerConfig.inputMeasurementParticlesMap = "measurement_particles_map";
+  writerConfig.filePath = path;
+  writerConfig.writeRNTuple = writeRNTuple;
+  writerConfig.writeCovMat = true;
+
+  RootTrackSummaryWriter writer(writerConfig, Acts::Logging::WARNING);
+  if (worker.has_value()) {
+    BOOST_REQUIRE(writer.shardOutput(*worker) == ProcessCode::SUCCESS);
+  }
+
+  // the track container is not default constructible, which the generic
+  // read write tool requires
+  for (std::size_t iEvent = 0; iEvent < events.size(); ++iEvent) {
+    WhiteBoard board;
+    AlgorithmContext ctx(0, iEvent, board);
+    addToWhiteBoard(writerConfig.inputTracks, events[iEvent], board);
+    addToWhiteBoard(writerConfig.inputParticles, SimParticleContainer{},
+                    board);
+    addToWhiteBoard(writerConfig.inputMeasurementParticlesMap,
+                    RootTrackSummaryWriter::HitParticlesMap{}, board);
+    writer.internalExecute(ctx);
+  }
+
+  writer.finalize();
+}
+
+/// Equality which also holds for the NaN written for missing values
+template <typename T>
+bool sameValue(const T& a, const T& b) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+  } else {
+    return a == b;
+  }
+}
+
+template <typename T>
+bool sameValue(const std::vector<T>& a, const std::vector<T>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    if (!sameValue(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Read a column of all entries from the tree
+template <typename T>
+std::vector<T> readTreeColumn(TTree& tree, const std::string& name) {
+  TTreeReader reader(&tree);
+  TTreeReaderValue<T> value(reader, name.c_str());
+  std::vector<T> column;
+  while (reader.Next()) {
+    column.push_back(*value);
+  }
+  return column;
+}
+
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+/// Check that the RNTuple has the column of the tree with the same values
+template <typename T>
+void checkColumn(TTree& tree, ROOT::Experimental::RNTupleReader& ntuple,
+                 const std::string& name) {
+  BOOST_TEST_CONTEXT("Column " << name) {
+    std::vector<T> expected = readTreeColumn<T>(tree, name);
+    BOOST_REQUIRE_EQUAL(expected.size(), ntuple.GetNEntries());
+    auto view = ntuple.GetView<T>(name);
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      BOOST_CHECK(sameValue(view(i), expected[i]));
+    }
+  }
+}
+#endif
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(RootTrackSummaryWriterTests)
+
+BOOST_AUTO_TEST_CASE(TreeOutput) {
+  std::vector<ConstTrackContainer> events = {
+      makeTestTracks(4), makeTestTracks(0), makeTestTracks(3)};
+  writeTracks("./tracksummary_tree.root", false, events);
+
+  auto file = std::unique_ptr<TFile>(TFile::Open("./tracksummary_tree.root"));
+  BOOST_REQUIRE(file != nullptr);
+  auto* tree = file->Get<TTree>("tracksummary");
+  BOOST_REQUIRE(tree != nullptr);
+  BOOST_CHECK_EQUAL(tree->GetEntries(), 3);
+
+  auto eventNr = readTreeColumn<std::uint32_t>(*tree, "event_nr");
+  auto nMeasurements =
+      readTreeColumn<std::vector<unsigned int>>(*tree, "nMeasurements");
+  auto hasFittedParams =
+      readTreeColumn<std::vector<bool>>(*tree, "hasFittedParams");
+  auto qop = readTreeColumn<std::vector<float>>(*tree, "eQOP_fit");
+  auto cov = readTreeColumn<std::vector<float>>(*tree, "cov_eLOC0_eLOC1");
+  BOOST_REQUIRE_EQUAL(eventNr.size(), events.size());
+  for (std::size_t iEvent = 0; iEvent < events.size(); ++iEvent) {
+    BOOST_CHECK_EQUAL(eventNr[iEvent], iEvent);
+    const auto& tracks = events[iEvent];
+    BOOST_REQUIRE_EQUAL(nMeasurements[iEvent].size(), tracks.size());
+    BOOST_REQUIRE_EQUAL(qop[iEvent].size(), tracks.size());
+    for (const auto& track : tracks) {
+      const auto i = track.index();
+      BOOST_CHECK_EQUAL(nMeasurements[iEvent][i], track.nMeasurements());
+      BOOST_CHECK_EQUAL(static_cast<bool>(hasFittedParams[iEvent][i]),
+                        track.hasReferenceSurface());
+      if (track.hasReferenceSurface()) {
+        BOOST_CHECK_EQUAL(qop[iEvent][i],
+                          static_cast<float>(track.qOverP()));
+        BOOST_CHECK_EQUAL(cov[iEvent][i],
+                          static_cast<float>(track.covariance()(
+                              Acts::eBoundLoc0, Acts::eBoundLoc1)));
+      } else {
+        BOOST_CHECK(std::isnan(qop[iEvent][i]));
+        BOOST_CHECK(std::isnan(cov[iEvent][i]));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(WorkerOutput) {
+  std::vector<ConstTrackContainer> events = {makeTestTracks(2),
+                                             makeTestTracks(5)};
+  writeTracks("./tracksummary_shard.root", false, events, 3u);
+
+  // the writer continues in its own file for the worker
+  auto file = std::unique_ptr<TFile>(
+      TFile::Open("./tracksummary_shard_worker3.root"));
+  BOOST_REQUIRE(file != nullptr);
+  auto* tree = file->Get<TTree>("tracksummary");
+  BOOST_REQUIRE(tree != nullptr);
+  BOOST_CHECK_EQUAL(tree->GetEntries(), 2);
+  auto nMeasurements =
+      readTreeColumn<std::vector<unsigned int>>(*tree, "nMeasurements");
+  BOOST_REQUIRE_EQUAL(nMeasurements.size(), events.size());
+  BOOST_CHECK_EQUAL(nMeasurements[0].size(), 2u);
+  BOOST_CHECK_EQUAL(nMeasurements[1].size(), 5u);
+}
+
+#ifdef ACTS_EXAMPLES_ROOT_RNTUPLE
+BOOST_AUTO_TEST_CASE(RNTupleRoundTrip) {
+  std::vector<ConstTrackContainer> events = {
+      makeTestTracks(4), makeTestTracks(0), makeTestTracks(3)};
+  writeTracks("./tracksummary_ref.root", false, events);
+  writeTracks("./tracksummary_ntuple.root", true, events);
+
+  auto file = std::unique_ptr<TFile>(TFile::Open("./tracksummary_ref.root"));
+  BOOST_REQUIRE(file != nullptr);
+  auto* tree = file->Get<TTree>("tracksummary");
+  BOOST_REQUIRE(tree != nullptr);
+  auto ntuple = ROOT::Experimental::RNTupleReader::Open(
+      "tracksummary", "./tracksummary_ntuple.root");
+  BOOST_REQUIRE(ntuple != nullptr);
+  BOOST_REQUIRE_EQUAL(ntuple->GetNEntries(), tree->GetEntries());
+
+  checkColumn<std::uint32_t>(*tree, *ntuple, "event_nr");
+  checkColumn<std::vector<std::uint32_t>>(*tree, *ntuple, "track_nr");
+  for (const char* name :
+       {"nStates", "nMeasurements", "nOutliers", "nHoles", "NDF"}) {
+    checkColumn<std::vector<unsigned int>>(*tree, *ntuple, name);
+  }
+  for (const char* name : {"measurementChi2", "measurementVolume"}) {
+    checkColumn<std::vector<std::vector<double>>>(*tree, *ntuple, name);
+  }
+  checkColumn<std::vector<std::uint64_t>>(*tree, *ntuple,
+                                          "majorityParticleId");
+  checkColumn<std::vector<int>>(*tree, *ntuple, "t_charge");
+  checkColumn<std::vector<bool>>(*tree, *ntuple, "hasFittedParams");
+  for (const char* name :
+       {"chi2Sum", "t_pT", "eLOC0_fit", "eQOP_fit", "err_eQOP_fit",
+        "res_eQOP_fit", "pull_eQOP_fit", "cov_eLOC0_eLOC1", "cov_eT_eT"}) {
+    checkColumn<std::vector<float>>(*tree, *ntuple, name);
+  }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()